@@ -333,6 +333,14 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 1;
 
+      /**
+       * The first precomputation cycle only depends on the state of the
+       * current row. HyperbolicModule can thus fuse it into the final
+       * write-back loop of the preceding step() by calling
+       * row_precomputation().
+       */
+      static constexpr bool have_row_local_precomputation = true;
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -345,6 +353,12 @@ namespace ryujin
                                unsigned int left,
                                unsigned int right) const;
 
+      /**
+       * Return the values of the first precomputation cycle for the state
+       * @p U_i.
+       */
+      precomputed_type row_precomputation(const state_type &U_i) const;
+
       //@}
       /**
        * @name Computing derived physical quantities
@@ -699,6 +713,15 @@ namespace ryujin
     }
 
 
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::row_precomputation(
+        const state_type &U_i) const -> precomputed_type
+    {
+      return {specific_entropy(U_i), harten_entropy(U_i)};
+    }
+
+
     template <int dim, typename Number>
     template <typename DISPATCH, typename SPARSITY>
     DEAL_II_ALWAYS_INLINE inline void
@@ -730,9 +753,7 @@ namespace ryujin
         dispatch_check(i);
 
         const auto U_i = U.template get_tensor<Number>(i);
-        const precomputed_type prec_i{specific_entropy(U_i),
-                                      harten_entropy(U_i)};
-        precomputed.template write_tensor<Number>(prec_i, i);
+        precomputed.template write_tensor<Number>(row_precomputation(U_i), i);
       }
     }
 
@@ -410,6 +410,13 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 2;
 
+      /**
+       * The first precomputation cycle evaluates the equation of state
+       * for whole index ranges and cannot be fused into the write-back
+       * loop of HyperbolicModule::step().
+       */
+      static constexpr bool have_row_local_precomputation = false;
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -914,6 +921,8 @@ namespace ryujin
       }   /* cycle == 0 */
 
       if (cycle == 1) {
+        dealii::AlignedVector<unsigned int> column_buffer;
+
         RYUJIN_OMP_FOR
         for (unsigned int i = left; i < right; i += stride_size) {
           using PT = precomputed_type;
@@ -929,7 +938,8 @@ namespace ryujin
           auto prec_i = precomputed.template get_tensor<Number, PT>(i);
           auto &[p_i, gamma_min_i, s_i, eta_i] = prec_i;
 
-          const unsigned int *js = sparsity_simd.columns(i) + stride_size;
+          const unsigned int *js =
+              sparsity_simd.columns(i, column_buffer) + stride_size;
           for (unsigned int col_idx = 1; col_idx < row_length;
                ++col_idx, js += stride_size) {
 
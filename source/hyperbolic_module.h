@@ -10,6 +10,9 @@
 #include "convenience_macros.h"
 #include "initial_values.h"
 #include "offline_data.h"
+#include "openmp.h"
+#include "patterns_conversion.h"
+#include "persistent_requests.h"
 #include "sparse_matrix_simd.h"
 #include "state_vector.h"
 
@@ -19,6 +22,7 @@
 #include <deal.II/lac/sparse_matrix.templates.h>
 #include <deal.II/lac/vector.h>
 
+#include <cstdint>
 #include <functional>
 
 namespace ryujin
@@ -59,6 +63,24 @@ namespace ryujin
   class Restart final
   {
   };
+} // namespace ryujin
+
+#ifndef DOXYGEN
+DECLARE_ENUM(
+    ryujin::LoopSchedule,
+    LIST({ryujin::LoopSchedule::static_schedule, "static"},
+         {ryujin::LoopSchedule::dynamic_schedule, "dynamic"},
+         {ryujin::LoopSchedule::guided_schedule, "guided"}, ));
+
+DECLARE_ENUM(
+    ryujin::PayloadPrecision,
+    LIST({ryujin::PayloadPrecision::full, "full"},
+         {ryujin::PayloadPrecision::single, "single"},
+         {ryujin::PayloadPrecision::fixed_point_16, "fixed point 16"}, ));
+#endif
+
+namespace ryujin
+{
 
 
   /**
@@ -122,6 +144,16 @@ namespace ryujin
      */
     void prepare();
 
+    /**
+     * Allocate the scratch storage needed for reusing the first stage of
+     * a Runge-Kutta step on restart (see request_first_stage_reuse()) if
+     * @p restarts_possible is true and the "restart reuses first stage"
+     * parameter is set, and release it otherwise. The TimeIntegrator
+     * calls this function after prepare() depending on its CFL recovery
+     * strategy.
+     */
+    void prepare_first_stage_reuse(const bool restarts_possible) const;
+
     //@}
     /**
      * @name Functons for performing explicit time steps
@@ -150,6 +182,27 @@ namespace ryujin
      */
     void prepare_state_vector(StateVector &state_vector, Number t) const;
 
+    /**
+     * Same as prepare_state_vector() for a @p state_vector that holds the
+     * unmodified result of the last call to step(), for example the next
+     * stage of a Runge-Kutta scheme. If the "fuse precomputation"
+     * parameter is set, then step() already computed the values of the
+     * first precomputation cycle in its final write-back loop (for
+     * hyperbolic systems with a row local first cycle and without
+     * multirate time stepping). In this case the function only reapplies
+     * boundary conditions (recomputing the precomputed values of all
+     * affected rows), updates ghost ranges, and runs the remaining
+     * precomputation cycles.
+     *
+     * @note The state vector must not be modified between the call to
+     * step() and this function. Use prepare_state_vector() otherwise.
+     */
+    void prepare_stage_state_vector(StateVector &state_vector, Number t) const
+    {
+      fused_precomputation_requested_ = true;
+      prepare_state_vector(state_vector, t);
+    }
+
     /**
      * Given a reference to a previous state vector @p old_U perform an
      * explicit euler step (and store the result in @p new_U). The
@@ -222,6 +275,110 @@ namespace ryujin
         Number tau = Number(0.),
         std::atomic<Number> tau_max = std::numeric_limits<Number>::max()) const;
 
+    /**
+     * Multirate (local) time stepping: If the "multirate levels"
+     * parameter L is nonzero, then every row i is assigned a rate level
+     * l_i in [0, L] at the beginning of a cycle of 2^L substeps (in
+     * substep 0). Row i advances with the local time step size 2^l_i tau,
+     * where tau is the time step size of substep 0, but only changes its
+     * state every 2^l_i substeps. In between, the increments are
+     * accumulated with a weight of 2^-l_i. Every substep is thus
+     * conservative (both sides of an edge use the same pair of states and
+     * an effective time step size tau) and every row update is a convex
+     * combination of invariant domain preserving updates with the local
+     * time step size 2^l_i tau.
+     *
+     * A row whose distance-(1 + limiter iterations) neighborhood only
+     * contains rows with a rate level of at least a_i sees constant data
+     * for 2^a_i consecutive substeps. The step() function thus only
+     * visits such a row every 2^a_i substeps. Every visited row verifies
+     * in step 3 that 2^l_i tau is still an admissible local time step
+     * size and requests a restart of the cycle otherwise.
+     *
+     * @note prepare_state_vector() still runs the precomputation over all
+     * rows in every substep: The precomputation_loop() of the hyperbolic
+     * system distributes contiguous index ranges over threads and has no
+     * notion of skipped rows.
+     *
+     * This function sets the number of the current substep within a
+     * multirate cycle. Substep 0 (re)assigns rate levels. The function
+     * must be called prior to calling prepare_state_vector() and step().
+     */
+    void multirate_substep(unsigned int substep) const
+    {
+      Assert(substep < (1u << n_rate_levels_), dealii::ExcInternalError());
+      multirate_substep_ = substep;
+    }
+
+    /**
+     * Given the @p visible_state_vector used as input for the current
+     * substep, the accumulated increments @p increment_state_vector, and
+     * the result of the current substep @p substep_state_vector, update
+     * the increments of all rows that have been visited in the current
+     * substep and apply them to all rows that complete their local time
+     * step.
+     */
+    void multirate_update(StateVector &visible_state_vector,
+                          StateVector &increment_state_vector,
+                          const StateVector &substep_state_vector) const;
+
+    /**
+     * Print a status line with the distribution of rate levels and the
+     * fraction of row updates that are saved compared to stepping all
+     * rows with the same time step size (if multirate time stepping is
+     * enabled).
+     *
+     * @note This function performs MPI reductions and has to be called on
+     * all MPI ranks.
+     */
+    void print_multirate_statistics(std::ostream &output) const;
+
+    /**
+     * The number of multirate levels L (0 if multirate time stepping is
+     * disabled).
+     */
+    ACCESSOR_READ_ONLY(n_rate_levels)
+
+    /**
+     * Restart recovery: The d_ij matrix, the indicator values alpha_i, and
+     * the CFL bound computed in the first stage of a Runge-Kutta step
+     * (i.e., the call to step() with @p tau set to 0) do not depend on the
+     * time step size. If the "restart reuses first stage" parameter is
+     * set, this data is kept until the next first stage. Calling this
+     * function requests that the next first stage operating on the same
+     * (unmodified) state vector skips steps 2 and 3 and only redoes the
+     * tau-dependent steps 4 - 7 with the current CFL number.
+     */
+    void request_first_stage_reuse() const
+    {
+      first_stage_reuse_requested_ = keep_first_stage_;
+    }
+
+    /**
+     * Limiter slack probe: If @p factor is larger than 1, step()
+     * additionally checks in the first limiter pass of every stage whether
+     * the low-order update would still be within the limiter bounds for a
+     * time step size enlarged by @p factor. The result (accumulated over
+     * all calls to step() since the last call to this function) is
+     * returned by limiter_slack_exhausted(). Set @p factor to 1 to disable
+     * the probe.
+     *
+     * @note The probe requires a low-order update that depends linearly
+     * on the time step size and is skipped otherwise (source terms, affine
+     * shifts, multirate time stepping).
+     */
+    void limiter_slack_probe(Number factor) const
+    {
+      limiter_slack_probe_factor_ = factor;
+      limiter_slack_exhausted_ = false;
+    }
+
+    /**
+     * Returns true if the low-order update of at least one row left the
+     * limiter bounds in the probe requested with limiter_slack_probe().
+     */
+    ACCESSOR_READ_ONLY(limiter_slack_exhausted)
+
     /**
      * Sets the relative CFL number used for computing an appropriate
      * time-step size to the given value. The CFL number must be a positive
@@ -259,7 +416,8 @@ namespace ryujin
     /**
      * Return a reference to alpha vector storing indicator values. Note
      * that the values stored in alpha correspond to the last step executed
-     * by this class.
+     * by this class (or to the first stage of the last Runge-Kutta step if
+     * the "restart reuses first stage" parameter is set).
      */
     ACCESSOR_READ_ONLY(alpha)
 
@@ -274,6 +432,51 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(n_warnings)
 
+    /**
+     * The number of first stages that were recovered from kept data after
+     * a restart (see request_first_stage_reuse()).
+     */
+    ACCESSOR_READ_ONLY(n_reused_first_stages)
+
+    /**
+     * Returns true if the p_ij matrix is recomputed on the fly in the
+     * limiter passes instead of being stored.
+     */
+    ACCESSOR_READ_ONLY(recompute_pij)
+
+    /**
+     * Print a status line with the fraction of time threads spent idle in
+     * the synchronization barriers of the step kernels (if thread load
+     * statistics are enabled). This function is used for constructing the
+     * status message displayed periodically in the TimeLoop.
+     *
+     * @note This function performs MPI reductions and has to be called on
+     * all MPI ranks.
+     */
+    void print_thread_statistics(std::ostream &output) const;
+
+    /**
+     * Print a status line with the time spent in MPI ghost exchanges
+     * issued from the step kernels and the fraction of it that was hidden
+     * behind computation (see SynchronizationDispatch). This function is
+     * used for constructing the status message displayed periodically in
+     * the TimeLoop.
+     *
+     * @note This function performs MPI reductions and has to be called on
+     * all MPI ranks.
+     */
+    void print_communication_statistics(std::ostream &output) const;
+
+    /**
+     * Print a report of how the memory pages of all temporary vectors and
+     * matrices are distributed over NUMA nodes (if the report is
+     * enabled).
+     *
+     * @note This function performs MPI reductions and has to be called on
+     * all MPI ranks.
+     */
+    void print_page_placement(std::ostream &output) const;
+
     // FIXME: refactor to function
     mutable IDViolationStrategy id_violation_strategy_;
 
@@ -292,6 +495,21 @@ namespace ryujin
     typename Description::template RiemannSolver<dim, Number>::Parameters
         riemann_solver_parameters_;
 
+    bool recompute_pij_;
+    bool dij_global_upper_triangle_;
+
+    LoopSchedule tail_loop_schedule_;
+    unsigned int tail_loop_chunk_size_;
+    bool fuse_high_order_update_;
+    bool limiter_active_set_;
+    bool transparent_huge_pages_;
+    bool page_placement_report_;
+    bool thread_load_statistics_enabled_;
+    unsigned int n_rate_levels_;
+    PayloadPrecision ghost_payload_precision_;
+    bool restart_reuse_first_stage_;
+    bool fuse_precomputation_;
+
     //@}
 
     //@}
@@ -314,6 +532,19 @@ namespace ryujin
 
     mutable unsigned int n_warnings_;
 
+    mutable unsigned int n_reused_first_stages_;
+
+    unsigned int n_lower_ghosts_;
+
+    mutable ThreadLoadStatistics thread_load_statistics_;
+
+    mutable CommunicationStatistics communication_statistics_;
+
+    mutable std::vector<std::vector<unsigned int>> limiter_active_rows_;
+
+    std::vector<unsigned int> boundary_permutation_;
+    std::vector<std::pair<unsigned int, unsigned int>> boundary_ranges_;
+
     InitialPrecomputedVector initial_precomputed_;
 
     using ScalarVector = typename Vectors::ScalarVector<Number>;
@@ -321,6 +552,7 @@ namespace ryujin
 
     static constexpr auto n_bounds =
         Description::template Limiter<dim, Number>::n_bounds;
+
     mutable Vectors::MultiComponentVector<Number, n_bounds> bounds_;
 
     using HyperbolicVector =
@@ -332,6 +564,50 @@ namespace ryujin
     mutable SparseMatrixSIMD<Number> lij_matrix_next_;
     mutable SparseMatrixSIMD<Number, problem_dimension> pij_matrix_;
 
+    /*
+     * Restart recovery: d_ij and alpha_i of all stages but the first of a
+     * Runge-Kutta step are computed in these scratch objects (that are
+     * swapped with dij_matrix_ and alpha_), so that the data of the first
+     * stage survives. We additionally record the state vector and the
+     * (rank-local) CFL bound tau_max / cfl of the first stage.
+     */
+    mutable bool keep_first_stage_;
+    mutable SparseMatrixSIMD<Number> dij_matrix_scratch_;
+    mutable ScalarVector alpha_scratch_;
+    mutable bool first_stage_reuse_requested_;
+    mutable const Number *first_stage_U_;
+    mutable Number first_stage_tau_bound_;
+
+    mutable Number limiter_slack_probe_factor_;
+    mutable bool limiter_slack_exhausted_;
+
+    mutable bool fused_precomputation_requested_;
+    mutable const Number *fused_precomputation_U_;
+
+    /*
+     * Fused ghost exchange with persistent MPI requests for the state
+     * vector, the precomputed values, alpha_, r_, and bounds_:
+     */
+    mutable PersistentGhostExchange<Number> ghost_exchange_;
+
+    /*
+     * Multirate time stepping: The local CFL time step size recorded in
+     * substep 0, the time step size factor 2^l_i, and (scratch) vectors
+     * for distributing rate levels over ghost ranges. The rate level
+     * l_i, the activity level a_i and the minimal activity level of the
+     * SIMD stride of row i are additionally stored as plain byte arrays.
+     */
+    void update_rate_levels(Number tau_min) const;
+
+    mutable unsigned int multirate_substep_;
+    mutable ScalarVector rate_tau_;
+    mutable ScalarVector rate_factor_;
+    mutable ScalarVector rate_scratch_;
+    mutable ScalarVector rate_scratch_next_;
+    mutable std::vector<std::uint8_t> rate_levels_;
+    mutable std::vector<std::uint8_t> rate_activity_;
+    mutable std::vector<std::uint8_t> rate_stride_activity_;
+
     //@}
   };
 
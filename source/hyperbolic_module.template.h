@@ -7,13 +7,19 @@
 
 #include "hyperbolic_module.h"
 #include "introspection.h"
+#include "numa.h"
 #include "openmp.h"
 #include "scope.h"
 #include "simd.h"
 
 #include "sparse_matrix_simd.template.h"
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
 
 namespace ryujin
 {
@@ -45,7 +51,130 @@ namespace ryujin
       , cfl_(0.2)
       , n_restarts_(0)
       , n_warnings_(0)
+      , n_reused_first_stages_(0)
+      , keep_first_stage_(false)
+      , first_stage_reuse_requested_(false)
+      , first_stage_U_(nullptr)
+      , first_stage_tau_bound_(0.)
+      , limiter_slack_probe_factor_(1.)
+      , limiter_slack_exhausted_(false)
+      , fused_precomputation_requested_(false)
+      , fused_precomputation_U_(nullptr)
   {
+    recompute_pij_ = false;
+    add_parameter(
+        "recompute p_ij",
+        recompute_pij_,
+        "If set to true the p_ij matrix is not stored in step 4 but "
+        "recomputed on the fly in the limiter passes. This trades additional "
+        "flux evaluations for a significant reduction in memory footprint "
+        "and bandwidth");
+
+    dij_global_upper_triangle_ = false;
+    add_parameter(
+        "d_ij global upper triangle",
+        dij_global_upper_triangle_,
+        "If set to true only d_ij entries that lie in the upper triangular "
+        "part of the matrix with respect to the global enumeration are "
+        "computed. The missing entries are exchanged over MPI ranks. This "
+        "avoids computing d_ij twice on MPI rank boundaries.");
+
+    tail_loop_schedule_ = LoopSchedule::static_schedule;
+    add_parameter("tail loop schedule",
+                  tail_loop_schedule_,
+                  "OpenMP loop schedule used for the non-vectorized index "
+                  "range [n_internal, n_owned) in all step kernels. Possible "
+                  "values: static, dynamic, guided");
+
+    tail_loop_chunk_size_ = 0;
+    add_parameter("tail loop chunk size",
+                  tail_loop_chunk_size_,
+                  "Chunk size of the tail loop schedule. A value of 0 selects "
+                  "the default chunk size of the chosen schedule. Note that "
+                  "a static schedule with a nonzero chunk size no longer "
+                  "matches the first-touch placement of the kernel arrays.");
+
+    fuse_high_order_update_ = false;
+    add_parameter(
+        "fuse high-order update",
+        fuse_high_order_update_,
+        "If set to true the computation of the first round of l_ij and "
+        "the high-order update share one sweep: the update is accumulated "
+        "with the (non-symmetrized) l_ij right away and the subsequent "
+        "sweep only subtracts the symmetrization correction. Only takes "
+        "effect for a single limiter iteration.");
+
+    limiter_active_set_ = true;
+    add_parameter(
+        "limiter active set",
+        limiter_active_set_,
+        "If set to true (and the limiter performs two iterations), the "
+        "first limiter pass records all rows with a symmetrized l_ij < 1. "
+        "The second limiter pass and the final high-order update are then "
+        "only performed for these rows.");
+
+    transparent_huge_pages_ = false;
+    add_parameter("transparent huge pages",
+                  transparent_huge_pages_,
+                  "If set to true the storage of all temporary vectors and "
+                  "matrices is advised to be backed by transparent huge "
+                  "pages.");
+
+    page_placement_report_ = false;
+    add_parameter("page placement report",
+                  page_placement_report_,
+                  "If set to true a report on how the memory pages of all "
+                  "temporary vectors and matrices are placed across NUMA "
+                  "nodes is written to the log file.");
+
+    thread_load_statistics_enabled_ = false;
+    add_parameter("thread load statistics",
+                  thread_load_statistics_enabled_,
+                  "If set to true the per-thread busy and idle (barrier wait) "
+                  "times of all step kernels are recorded and reported.");
+
+    n_rate_levels_ = 0;
+    add_parameter("multirate levels",
+                  n_rate_levels_,
+                  "Number of additional rate levels L for multirate (local) "
+                  "time stepping with the erk 11 scheme. Rows are grouped by "
+                  "their local CFL time step size into levels l = 0, ..., L "
+                  "and advance with 2^l times the global time step size. Set "
+                  "to 0 to disable.");
+
+    ghost_payload_precision_ = PayloadPrecision::full;
+    add_parameter(
+        "ghost payload precision",
+        ghost_payload_precision_,
+        "Precision of the ghost exchanges of the indicator values alpha_i "
+        "and the limiter coefficients l_ij. Values are rounded down and "
+        "the owning MPI rank continues with the rounded values. Possible "
+        "values: full, single, fixed point 16. The state vector and the "
+        "limiter bounds are always exchanged in full precision.");
+
+    restart_reuse_first_stage_ = false;
+    add_parameter(
+        "restart reuses first stage",
+        restart_reuse_first_stage_,
+        "If set to true the d_ij matrix and the indicator values alpha_i "
+        "of the first stage of a Runge-Kutta step are kept (at the cost of "
+        "an additional scalar matrix and vector), so that a restart of the "
+        "step with a reduced CFL number skips steps 2 and 3 of the first "
+        "stage. The additional storage is only allocated if the CFL "
+        "recovery strategy of the time integrator can restart a step. Not "
+        "supported with multirate time stepping.");
+
+    fuse_precomputation_ = false;
+    add_parameter(
+        "fuse precomputation",
+        fuse_precomputation_,
+        "If set to true step() computes the values of the first "
+        "precomputation cycle for the new state right after writing back "
+        "the final update of every row. Subsequent stages of a Runge-Kutta "
+        "scheme then skip the corresponding sweep in "
+        "prepare_stage_state_vector(). Only supported for hyperbolic "
+        "systems with a row local first precomputation cycle and without "
+        "multirate time stepping.");
   }
 
 
@@ -61,28 +190,198 @@ namespace ryujin
                 dealii::ExcMessage(
                     "The number of limiter iterations must be between [0,2]"));
 
-    /* Initialize vectors: */
+    /*
+     * Initialize vectors: All vectors and matrices are first-touched in
+     * parallel with the same static schedule used in step() so that
+     * memory pages are placed on the NUMA node of the thread working on
+     * them.
+     */
+
+    const unsigned int n_internal = offline_data_->n_locally_internal();
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+    constexpr auto simd_length = VectorizedArray<Number>::size();
 
     const auto &scalar_partitioner = offline_data_->scalar_partitioner();
     alpha_.reinit(scalar_partitioner);
+    NUMA::first_touch(
+        alpha_.begin(),
+        n_owned + scalar_partitioner->n_ghost_indices(),
+        n_internal,
+        n_owned,
+        simd_length,
+        [](const unsigned int i, const unsigned int n) {
+          return std::make_pair(std::size_t(i), std::size_t(i + n));
+        },
+        transparent_huge_pages_);
+
+    /* Allocated by prepare_first_stage_reuse() if restarts are possible: */
+    prepare_first_stage_reuse(false);
+
+    fused_precomputation_requested_ = false;
+    fused_precomputation_U_ = nullptr;
+
     bounds_.reinit_with_scalar_partitioner(scalar_partitioner);
+    bounds_.first_touch(n_internal, transparent_huge_pages_);
 
     r_.reinit(offline_data_->hyperbolic_vector_partitioner());
+    r_.first_touch(n_internal, transparent_huge_pages_);
+
+    /* The persistent requests are bound to the old vectors: */
+    ghost_exchange_.clear();
+
     using View =
         typename Description::template HyperbolicSystemView<dim, Number>;
 
     /* Initialize matrices: */
 
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
-    dij_matrix_.reinit(sparsity_simd);
-    lij_matrix_.reinit(sparsity_simd);
-    lij_matrix_next_.reinit(sparsity_simd);
-    pij_matrix_.reinit(sparsity_simd);
+    dij_matrix_.reinit(sparsity_simd, transparent_huge_pages_);
+    lij_matrix_.reinit(sparsity_simd, transparent_huge_pages_);
+    lij_matrix_next_.reinit(sparsity_simd, transparent_huge_pages_);
+    if (!recompute_pij_)
+      pij_matrix_.reinit(sparsity_simd, transparent_huge_pages_);
+
+    thread_load_statistics_.reinit(thread_load_statistics_enabled_);
+    communication_statistics_.reset();
+
+    limiter_active_rows_.clear();
+    limiter_active_rows_.resize(max_thread_count());
+
+    /* Multirate time stepping: */
+
+    AssertThrow(n_rate_levels_ <= 8,
+                dealii::ExcMessage("The number of multirate levels must be "
+                                   "between [0,8]"));
+    AssertThrow(n_rate_levels_ == 0 ||
+                    !offline_data_->discretization()
+                         .have_discontinuous_ansatz(),
+                dealii::ExcMessage("Multirate time stepping is only "
+                                   "supported for a continuous finite "
+                                   "element ansatz"));
+
+    multirate_substep_ = 0;
+    rate_levels_.assign(n_rate_levels_ == 0 ? 0 : n_owned, 0);
+    rate_activity_.assign(rate_levels_.size(), 0);
+    rate_stride_activity_.assign(rate_levels_.size(), 0);
+    if (n_rate_levels_ != 0) {
+      rate_tau_.reinit(scalar_partitioner);
+      rate_factor_.reinit(scalar_partitioner);
+      rate_factor_ = Number(1.);
+      rate_scratch_.reinit(scalar_partitioner);
+      rate_scratch_next_.reinit(scalar_partitioner);
+    }
+
+    /*
+     * Group boundary map entries for the thread-parallel application of
+     * boundary conditions in prepare_state_vector(): All entries belonging
+     * to the same degree of freedom form one group that is processed
+     * sequentially (in original order) by a single thread. Groups
+     * consisting of do_nothing entries only are dropped. The remaining
+     * groups are ordered by the boundary id of their first entry so that
+     * consecutive iterations take the same branch in
+     * apply_boundary_conditions().
+     */
+
+    {
+      const auto &boundary_map = offline_data_->boundary_map();
+      const auto index = [&](const unsigned int k) {
+        return std::get<0>(boundary_map[boundary_permutation_[k]]);
+      };
+      const auto id = [&](const unsigned int k) {
+        return std::get<4>(boundary_map[boundary_permutation_[k]]);
+      };
+
+      boundary_permutation_.resize(boundary_map.size());
+      std::iota(boundary_permutation_.begin(), boundary_permutation_.end(), 0);
+      std::stable_sort(boundary_permutation_.begin(),
+                       boundary_permutation_.end(),
+                       [&](const auto left, const auto right) {
+                         return std::get<0>(boundary_map[left]) <
+                                std::get<0>(boundary_map[right]);
+                       });
+
+      boundary_ranges_.clear();
+      for (unsigned int k = 0; k < boundary_permutation_.size();) {
+        bool do_nothing = true;
+        unsigned int end = k;
+        for (; end < boundary_permutation_.size() && index(end) == index(k);
+             ++end)
+          do_nothing = do_nothing && (id(end) == Boundary::do_nothing);
+
+        if (!do_nothing)
+          boundary_ranges_.emplace_back(k, end);
+        k = end;
+      }
+
+      std::stable_sort(boundary_ranges_.begin(),
+                       boundary_ranges_.end(),
+                       [&](const auto &left, const auto &right) {
+                         return id(left.first) < id(right.first);
+                       });
+    }
 
     /* Set up initial precomputed vector: */
 
     initial_precomputed_ =
         initial_values_->interpolate_initial_precomputed_vector();
+
+    /*
+     * Determine the number of ghost indices that precede the locally
+     * owned index range in the global enumeration. Ghost indices are
+     * sorted; these ghost indices thus correspond to the local index range
+     * [n_owned, n_owned + n_lower_ghosts_).
+     */
+
+    n_lower_ghosts_ = 0;
+    if (dij_global_upper_triangle_) {
+      const auto owned_begin = scalar_partitioner->local_range().first;
+      for (const auto index : scalar_partitioner->ghost_indices()) {
+        if (index >= owned_begin)
+          break;
+        ++n_lower_ghosts_;
+      }
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::prepare_first_stage_reuse(
+      const bool restarts_possible) const
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "HyperbolicModule<Description, dim, Number>::"
+              << "prepare_first_stage_reuse()" << std::endl;
+#endif
+
+    keep_first_stage_ = restart_reuse_first_stage_ && restarts_possible;
+    first_stage_reuse_requested_ = false;
+    first_stage_U_ = nullptr;
+
+    if (!keep_first_stage_) {
+      alpha_scratch_.reinit(std::size_t(0));
+      dij_matrix_scratch_ = SparseMatrixSIMD<Number>();
+      return;
+    }
+
+    const unsigned int n_internal = offline_data_->n_locally_internal();
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+    constexpr auto simd_length = VectorizedArray<Number>::size();
+
+    const auto &scalar_partitioner = offline_data_->scalar_partitioner();
+    alpha_scratch_.reinit(scalar_partitioner);
+    NUMA::first_touch(
+        alpha_scratch_.begin(),
+        n_owned + scalar_partitioner->n_ghost_indices(),
+        n_internal,
+        n_owned,
+        simd_length,
+        [](const unsigned int i, const unsigned int n) {
+          return std::make_pair(std::size_t(i), std::size_t(i + n));
+        },
+        transparent_huge_pages_);
+
+    const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
+    dij_matrix_scratch_.reinit(sparsity_simd, transparent_huge_pages_);
   }
 
 
@@ -114,50 +413,98 @@ namespace ryujin
     unsigned int channel = 10;
     using VA = VectorizedArray<Number>;
 
+    /*
+     * Fused precomputation (see prepare_stage_state_vector()): We can only
+     * skip the first precomputation cycle if the state vector is the
+     * unmodified result of the last call to step().
+     */
+    const bool fused_precomputation = fused_precomputation_requested_ &&
+                                      fused_precomputation_U_ == U.begin();
+    fused_precomputation_requested_ = false;
+    fused_precomputation_U_ = nullptr;
+
     Scope scope(computing_timer_,
                 "time step [H] 1 - update boundary values, precompute values");
 
     LIKWID_MARKER_START("time_step_1a");
 
-    /* FIXME: not thread parallel... */
-    for (const auto &entry : boundary_map) {
-      const auto &[i, normal, normal_mass, boundary_mass, id, position] = entry;
+    /*
+     * Boundary map entries are grouped by degree of freedom and ordered by
+     * boundary id in prepare(). Different groups touch different degrees
+     * of freedom and can thus be processed concurrently.
+     */
 
-      /*
-       * Relay the task of applying appropriate boundary conditions to the
-       * Problem Description.
-       */
+    RYUJIN_PARALLEL_REGION_BEGIN
 
-      if (id == Boundary::do_nothing)
-        continue;
+    const auto view = hyperbolic_system_->template view<dim, Number>();
 
-      auto U_i = U.get_tensor(i);
+    RYUJIN_OMP_FOR
+    for (std::size_t k = 0; k < boundary_ranges_.size(); ++k) {
+      const auto [begin, end] = boundary_ranges_[k];
 
-      /* Use a lambda to avoid computing unnecessary state values */
-      auto get_dirichlet_data = [position = position, t = t, this]() {
-        return initial_values_->initial_state(position, t);
-      };
+      for (unsigned int l = begin; l < end; ++l) {
+        const auto &[i, normal, normal_mass, boundary_mass, id, position] =
+            boundary_map[boundary_permutation_[l]];
+
+        /*
+         * Relay the task of applying appropriate boundary conditions to
+         * the Problem Description.
+         */
+
+        if (id == Boundary::do_nothing)
+          continue;
 
-      const auto view = hyperbolic_system_->template view<dim, Number>();
-      U_i = view.apply_boundary_conditions(id, U_i, normal, get_dirichlet_data);
-      U.write_tensor(U_i, i);
+        auto U_i = U.get_tensor(i);
+
+        /* Use a lambda to avoid computing unnecessary state values */
+        auto get_dirichlet_data = [position = position, t = t, this]() {
+          return initial_values_->initial_state(position, t);
+        };
+
+        U_i = view.apply_boundary_conditions(
+            id, U_i, normal, get_dirichlet_data);
+        U.write_tensor(U_i, i);
+
+        if constexpr (View::have_row_local_precomputation) {
+          if (fused_precomputation)
+            precomputed.write_tensor(view.row_precomputation(U_i), i);
+        }
+      }
     }
 
-    LIKWID_MARKER_STOP("time_step_1a");
+    RYUJIN_PARALLEL_REGION_END
 
-    U.update_ghost_values();
+    LIKWID_MARKER_STOP("time_step_1a");
 
     /*
-     * Precompute values
+     * Precompute values:
+     *
+     * The first precomputation cycle only accesses locally owned state
+     * values. We thus defer the ghost exchange of U and fuse it with the
+     * exchange of the precomputed values of the first cycle (a single
+     * message per neighboring rank).
      */
 
-    if constexpr (n_precomputation_cycles != 0) {
+    if constexpr (n_precomputation_cycles == 0) {
+      ghost_exchange_.update_ghost_values(U, channel++);
+    } else {
       for (unsigned int cycle = 0; cycle < n_precomputation_cycles; ++cycle) {
 
-        SynchronizationDispatch synchronization_dispatch([&]() {
-          precomputed.update_ghost_values_start(channel++);
-          precomputed.update_ghost_values_finish();
-        });
+        if (cycle == 0 && fused_precomputation) {
+          ghost_exchange_.start({&U, &precomputed}, channel++);
+          ghost_exchange_.finish();
+          continue;
+        }
+
+        SynchronizationDispatch synchronization_dispatch(
+            [&]() {
+              if (cycle == 0)
+                ghost_exchange_.start({&U, &precomputed}, channel++);
+              else
+                ghost_exchange_.start(precomputed, channel++);
+              ghost_exchange_.finish();
+            },
+            &communication_statistics_);
 
         RYUJIN_PARALLEL_REGION_BEGIN
         LIKWID_MARKER_START(("time_step_1b"));
@@ -202,17 +549,38 @@ namespace ryujin
 
   namespace
   {
+    /**
+     * Internally used: returns true if the (local) index j of a column
+     * lies below the diagonal for the (locally owned) row index i. Ghost
+     * indices in the local index range [n_owned, lower_ghosts_end) are
+     * considered to be below the diagonal as well. (Setting
+     * lower_ghosts_end to n_owned recovers the plain comparison j < i in
+     * local enumeration.)
+     */
+    DEAL_II_ALWAYS_INLINE inline bool
+    below_diagonal(unsigned int i,
+                   unsigned int j,
+                   unsigned int n_owned,
+                   unsigned int lower_ghosts_end)
+    {
+      return j < i || (j >= n_owned && j < lower_ghosts_end);
+    }
+
+
     /**
      * Internally used: returns true if all indices are on the lower
      * triangular part of the matrix.
      */
     template <typename T>
-    bool all_below_diagonal(unsigned int i, const unsigned int *js)
+    bool all_below_diagonal(unsigned int i,
+                            const unsigned int *js,
+                            unsigned int n_owned,
+                            unsigned int lower_ghosts_end)
     {
       if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
         /* Non-vectorized sequential access. */
         const auto j = *js;
-        return j < i;
+        return below_diagonal(i, j, n_owned, lower_ghosts_end);
 
       } else {
         /* Vectorized fast access. index must be divisible by simd_length */
@@ -221,13 +589,111 @@ namespace ryujin
 
         bool all_below_diagonal = true;
         for (unsigned int k = 0; k < simd_length; ++k)
-          if (js[k] >= i + k) {
+          if (!below_diagonal(i + k, js[k], n_owned, lower_ghosts_end)) {
             all_below_diagonal = false;
             break;
           }
         return all_below_diagonal;
       }
     }
+
+
+    /**
+     * Internally used: returns true if any index is on the lower
+     * triangular part of the matrix.
+     */
+    template <typename T>
+    bool any_below_diagonal(unsigned int i,
+                            const unsigned int *js,
+                            unsigned int n_owned,
+                            unsigned int lower_ghosts_end)
+    {
+      if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
+        /* Non-vectorized sequential access. */
+        const auto j = *js;
+        return below_diagonal(i, j, n_owned, lower_ghosts_end);
+
+      } else {
+        /* Vectorized fast access. index must be divisible by simd_length */
+
+        constexpr auto simd_length = T::size();
+
+        for (unsigned int k = 0; k < simd_length; ++k)
+          if (below_diagonal(i + k, js[k], n_owned, lower_ghosts_end))
+            return true;
+        return false;
+      }
+    }
+
+
+    /**
+     * Internally used: returns a copy of @p b where all (vectorized)
+     * components with an index pair (i, j) on the lower triangular part
+     * of the matrix are replaced by the corresponding component of @p a.
+     */
+    template <typename T>
+    DEAL_II_ALWAYS_INLINE inline T
+    select_below_diagonal(unsigned int i,
+                          const unsigned int *js,
+                          unsigned int n_owned,
+                          unsigned int lower_ghosts_end,
+                          const T &a,
+                          const T &b)
+    {
+      if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
+        /* Non-vectorized sequential access. */
+        return below_diagonal(i, *js, n_owned, lower_ghosts_end) ? a : b;
+
+      } else {
+        /* Vectorized fast access. index must be divisible by simd_length */
+
+        constexpr auto simd_length = T::size();
+
+        T result = b;
+        for (unsigned int k = 0; k < simd_length; ++k)
+          if (below_diagonal(i + k, js[k], n_owned, lower_ghosts_end))
+            result[k] = a[k];
+        return result;
+      }
+    }
+
+
+    /**
+     * Internally used: returns true if any (vectorized) component of @p
+     * a is strictly less than the corresponding component of @p b.
+     */
+    template <typename T>
+    DEAL_II_ALWAYS_INLINE inline bool any_less_than(const T &a, const T &b)
+    {
+      if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
+        return a < b;
+
+      } else {
+        constexpr auto simd_length = T::size();
+        for (unsigned int k = 0; k < simd_length; ++k)
+          if (a[k] < b[k])
+            return true;
+        return false;
+      }
+    }
+
+
+    /**
+     * Internally used: select the loop schedule for a kernel loop. The
+     * non-vectorized loop over the index range [n_internal, n_owned)
+     * uses the configurable tail loop schedule, the vectorized loop
+     * always uses a static schedule.
+     */
+    template <typename T, typename Number>
+    DEAL_II_ALWAYS_INLINE inline void
+    select_loop_schedule(const LoopSchedule tail_loop_schedule,
+                         const unsigned int tail_loop_chunk_size)
+    {
+      if constexpr (std::is_same_v<T, Number>)
+        set_loop_schedule(tail_loop_schedule, tail_loop_chunk_size);
+      else
+        set_loop_schedule(LoopSchedule::static_schedule, 0);
+    }
   } // namespace
 
 
@@ -250,6 +716,7 @@ namespace ryujin
     auto &old_U = std::get<0>(old_state_vector);
     auto &old_precomputed = std::get<1>(old_state_vector);
     auto &new_U = std::get<0>(new_state_vector);
+    auto &new_precomputed = std::get<1>(new_state_vector);
 
     CALLGRIND_START_INSTRUMENTATION;
 
@@ -278,6 +745,7 @@ namespace ryujin
     const unsigned int n_export_indices = offline_data_->n_export_indices();
     const unsigned int n_internal = offline_data_->n_locally_internal();
     const unsigned int n_owned = offline_data_->n_locally_owned();
+    const unsigned int lower_ghosts_end = n_owned + n_lower_ghosts_;
 
     /* References to precomputed matrices and the stencil: */
 
@@ -298,6 +766,27 @@ namespace ryujin
     const Number measure_of_omega_inverse =
         Number(1.) / offline_data_->measure_of_omega();
 
+    /*
+     * Multirate time stepping: Skip all rows (or SIMD strides) that are
+     * not visited in the current substep, and scale the time step size
+     * of every row with its factor 2^l_i:
+     */
+    const bool multirate = n_rate_levels_ != 0;
+
+    const auto skip_row = [&](const unsigned int i) {
+      if (!multirate)
+        return false;
+      const unsigned int mask = (1u << rate_stride_activity_[i]) - 1u;
+      return (multirate_substep_ & mask) != 0;
+    };
+
+    const auto row_tau = [&](auto sentinel, const unsigned int i) {
+      using T = decltype(sentinel);
+      if (!multirate)
+        return T(tau);
+      return T(tau) * get_entry<T>(rate_factor_, i);
+    };
+
     /* A monotonically increasing "channel" variable for mpi_tags: */
     unsigned int channel = 10;
 
@@ -312,6 +801,58 @@ namespace ryujin
     /* A boolean signalling that a restart is necessary: */
     std::atomic<bool> restart_needed = false;
 
+    /*
+     * Restart recovery: Steps 2 and 3 only depend on the old state. Thus,
+     * the d_ij matrix, alpha_i, and the CFL bound of the first stage
+     * (with tau = 0) can be reused when the step is restarted with a
+     * smaller CFL number. All subsequent stages work on scratch copies
+     * that we swap in (and out at the end of the step):
+     */
+
+    const bool first_stage = tau == Number(0.);
+    const bool keep_first_stage = keep_first_stage_ && !multirate;
+    const bool swap_stage_data = keep_first_stage && !first_stage;
+    const bool reuse_first_stage = keep_first_stage && first_stage &&
+                                   first_stage_reuse_requested_ &&
+                                   first_stage_U_ == old_U.begin();
+    first_stage_reuse_requested_ = false;
+
+    if (swap_stage_data) {
+      std::swap(dij_matrix_, dij_matrix_scratch_);
+      alpha_.swap(alpha_scratch_);
+    }
+
+    /*
+     * Fused precomputation (see prepare_stage_state_vector()): Compute the
+     * values of the first precomputation cycle for the new state right
+     * after the final write-back of U_i_new while the state is still in
+     * cache. The final write-back happens in step 4 without limiting, in
+     * the last limiter pass, and for rows that the active set drops after
+     * the first limiter pass.
+     */
+    const bool fuse_precomputation = fuse_precomputation_ &&
+                                     View::have_row_local_precomputation &&
+                                     !multirate;
+
+    const auto write_precomputed =
+        [&](auto sentinel, const auto &U_i, const unsigned int i) {
+          using T = decltype(sentinel);
+          using View =
+              typename Description::template HyperbolicSystemView<dim, T>;
+          if constexpr (View::have_row_local_precomputation) {
+            const auto view = hyperbolic_system_->template view<dim, T>();
+            new_precomputed.template write_tensor<T>(
+                view.row_precomputation(U_i), i);
+          }
+        };
+
+    if (reuse_first_stage) {
+      /* Keep the timer names of the remaining steps: */
+      step_no += 2;
+      n_reused_first_stages_++;
+      tau_max.store(std::min(tau_max.load(), cfl_ * first_stage_tau_bound_));
+    }
+
     /*
      * -------------------------------------------------------------------------
      * Step 2: Compute off-diagonal d_ij, and alpha_i
@@ -329,22 +870,27 @@ namespace ryujin
      *      r ......
      *      r ......
      *
-     *  and symmetrize in Step 2.
+     *  and symmetrize in Step 3.
      *
-     *  MM: We could save a bit more computational resources by only
-     *  computing entries for which *IN A GLOBAL* enumeration j > i. But
-     *  the index translation, subsequent symmetrization, and exchange
-     *  sounds a bit too expensive...
+     *  If the "d_ij global upper triangle" option is set we save a bit
+     *  more computational resources by only computing entries for which
+     *  j > i holds true *IN THE GLOBAL* enumeration. This affects ghost
+     *  columns j: those with a global index smaller than the locally
+     *  owned range (the local index range [n_owned, lower_ghosts_end))
+     *  are skipped and later received from the neighboring MPI rank via
+     *  SparseMatrixSIMD::update_ghost_rows() in Step 3.
      * -------------------------------------------------------------------------
      */
 
-    {
+    if (!reuse_first_stage) {
       Scope scope(computing_timer_, scoped_name("compute d_ij, and alpha_i"));
 
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        alpha_.update_ghost_values_start(channel++);
-        alpha_.update_ghost_values_finish();
-      });
+      SynchronizationDispatch synchronization_dispatch(
+          [&]() {
+            ghost_exchange_.start(alpha_, channel++, ghost_payload_precision_);
+            ghost_exchange_.finish();
+          },
+          &communication_statistics_);
 
       RYUJIN_PARALLEL_REGION_BEGIN
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
@@ -364,14 +910,19 @@ namespace ryujin
         Indicator indicator(
             *hyperbolic_system_, indicator_parameters_, old_precomputed);
 
+        AlignedVector<unsigned int> column_buffer;
         bool thread_ready = false;
 
-        RYUJIN_OMP_FOR
+        select_loop_schedule<T, Number>(tail_loop_schedule_,
+                                        tail_loop_chunk_size_);
+        thread_load_statistics_.loop_begin();
+
+        RYUJIN_OMP_FOR_RUNTIME_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
           const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
+          if (row_length == 1 || skip_row(i))
             continue;
 
           synchronization_dispatch.check(
@@ -381,7 +932,7 @@ namespace ryujin
 
           indicator.reset(i, U_i);
 
-          const unsigned int *js = sparsity_simd.columns(i);
+          const unsigned int *js = sparsity_simd.columns(i, column_buffer);
           for (unsigned int col_idx = 0; col_idx < row_length;
                ++col_idx, js += stride_size) {
 
@@ -396,7 +947,7 @@ namespace ryujin
               continue;
 
             /* Only iterate over the upper triangular portion of d_ij */
-            if (all_below_diagonal<T>(i, js))
+            if (all_below_diagonal<T>(i, js, n_owned, lower_ghosts_end))
               continue;
 
             const auto norm = c_ij.norm();
@@ -412,6 +963,10 @@ namespace ryujin
           const auto hd_i = mass * measure_of_omega_inverse;
           write_entry<T>(alpha_, indicator.alpha(hd_i), i);
         }
+
+        thread_load_statistics_.loop_end();
+        RYUJIN_OMP_BARRIER
+        thread_load_statistics_.barrier_end();
       };
 
       /* Parallel non-vectorized loop: */
@@ -429,10 +984,13 @@ namespace ryujin
      * -------------------------------------------------------------------------
      */
 
-    {
+    if (!reuse_first_stage) {
       Scope scope(computing_timer_,
                   scoped_name("compute bdry d_ij, diag d_ii, and tau_max"));
 
+      std::vector<Number> thread_tau_max(max_thread_count(),
+                                         std::numeric_limits<Number>::max());
+
       /* Parallel region */
       RYUJIN_PARALLEL_REGION_BEGIN
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
@@ -470,7 +1028,7 @@ namespace ryujin
          * actually do not store anything in the d_ji entry itself because
          * we symmetrize the matrix later on anyway.
          */
-        if (j < i)
+        if (below_diagonal(i, j, n_owned, lower_ghosts_end))
           continue;
 
         const auto U_i = old_U.get_tensor(i);
@@ -489,86 +1047,211 @@ namespace ryujin
         dij_matrix_.write_entry(std::max(d_ij, d_ji), i, col_idx);
       }
 
-      /* Symmetrize d_ij: */
+      /*
+       * If we only computed the upper triangular part with respect to the
+       * global enumeration we now have to import all missing d_ji entries
+       * from neighboring MPI ranks:
+       */
+      if (dij_global_upper_triangle_) {
+        RYUJIN_OMP_SINGLE
+        {
+          dij_matrix_.update_ghost_rows_start(channel++);
+          dij_matrix_.update_ghost_rows_finish();
+        }
+      }
 
-      RYUJIN_OMP_FOR
-      for (unsigned int i = 0; i < n_owned; ++i) {
+      /*
+       * Symmetrize d_ij, compute d_ii and tau_max:
+       *
+       * We use the same split into a non-vectorized loop over the index
+       * range [n_internal, n_owned) and a vectorized SIMD loop over
+       * [0, n_internal) as in steps 2 and 4. Every thread reduces tau
+       * locally; the thread-local minima are combined after the parallel
+       * region.
+       */
 
-        /* Skip constrained degrees of freedom: */
-        const unsigned int row_length = sparsity_simd.row_length(i);
-        if (row_length == 1)
-          continue;
+      auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+        using T = decltype(sentinel);
+        unsigned int stride_size = get_stride_size<T>;
 
-        Number d_sum = Number(0.);
+#ifdef DEBUG
+        using RiemannSolverT =
+            typename Description::template RiemannSolver<dim, T>;
+        RiemannSolverT riemann_solver_t(
+            *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
+#endif
 
-        /* skip diagonal: */
-        const unsigned int *js = sparsity_simd.columns(i);
-        for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
-          const auto j =
-              *(i < n_internal ? js + col_idx * simd_length : js + col_idx);
+        T local_tau_max_t = T(std::numeric_limits<Number>::max());
+        AlignedVector<unsigned int> column_buffer;
+
+        RYUJIN_OMP_FOR
+        for (unsigned int i = left; i < right; i += stride_size) {
+
+          /* Skip constrained degrees of freedom: */
+          const unsigned int row_length = sparsity_simd.row_length(i);
+          if (row_length == 1 || skip_row(i))
+            continue;
+
+          T d_sum = T(0.);
+
+          /* skip diagonal: */
+          const unsigned int *js =
+              sparsity_simd.columns(i, column_buffer) + stride_size;
+          for (unsigned int col_idx = 1; col_idx < row_length;
+               ++col_idx, js += stride_size) {
+
+            auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
 
-          // fill lower triangular part of dij_matrix missing from step 1
-          if (j < i) {
-            const auto d_ji = dij_matrix_.get_transposed_entry(i, col_idx);
+            // fill lower triangular part of dij_matrix missing from step 1
+            if (any_below_diagonal<T>(i, js, n_owned, lower_ghosts_end)) {
+              const auto d_ji =
+                  dij_matrix_.template get_transposed_entry<T>(i, col_idx);
+              d_ij = select_below_diagonal<T>(
+                  i, js, n_owned, lower_ghosts_end, d_ji, d_ij);
+              dij_matrix_.template write_entry<T>(d_ij, i, col_idx);
+            }
 
 #ifdef DEBUG
-            /* Verify that d_ji == std::max(d_ij, d_ji): */
+            /* Verify that d_ij >= d_ij computed from (i, j): */
 
-            const auto U_i = old_U.get_tensor(i);
-            const auto U_j = old_U.get_tensor(j);
+            const auto U_i = old_U.template get_tensor<T>(i);
+            const auto U_j = old_U.template get_tensor<T>(js);
 
-            const auto c_ij = cij_matrix.get_tensor(i, col_idx);
-            Assert(c_ij.norm() > 1.e-12, ExcInternalError());
+            const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
             const auto norm_ij = c_ij.norm();
+            Assert(!any_less_than(norm_ij, T(1.e-12)), ExcInternalError());
             const auto n_ij = c_ij / norm_ij;
 
             const auto lambda_max =
-                riemann_solver.compute(U_i, U_j, i, &j, n_ij);
-            const auto d_ij = norm_ij * lambda_max;
+                riemann_solver_t.compute(U_i, U_j, i, js, n_ij);
 
-            Assert(d_ij <= d_ji + 1.0e-12,
+            Assert(!any_less_than(d_ij + T(1.0e-12), norm_ij * lambda_max),
                    dealii::ExcMessage("d_ij not symmetrized correctly on "
                                       "boundary degrees of freedom."));
 #endif
 
-            dij_matrix_.write_entry(d_ji, i, col_idx);
+            d_sum -= d_ij;
           }
 
-          d_sum -= dij_matrix_.get_entry(i, col_idx);
-        }
+          /*
+           * Make sure that we do not accidentally divide by zero. (Yes,
+           * this can happen for some (admittedly, rather esoteric) scalar
+           * conservation equations...).
+           */
+          d_sum = std::min(
+              d_sum, T(Number(-1.e6) * std::numeric_limits<Number>::min()));
 
-        /*
-         * Make sure that we do not accidentally divide by zero. (Yes, this
-         * can happen for some (admittedly, rather esoteric) scalar
-         * conservation equations...).
-         */
-        d_sum =
-            std::min(d_sum, Number(-1.e6) * std::numeric_limits<Number>::min());
+          /* write diagonal element */
+          dij_matrix_.template write_entry<T>(d_sum, i, 0);
 
-        /* write diagonal element */
-        dij_matrix_.write_entry(d_sum, i, 0);
+          const auto mass = get_entry<T>(lumped_mass_matrix, i);
+          const auto tau = T(cfl_) * mass / (Number(-2.) * d_sum);
+          local_tau_max_t = std::min(local_tau_max_t, tau);
 
-        const Number mass = lumped_mass_matrix.local_element(i);
-        const Number tau = cfl_ * mass / (Number(-2.) * d_sum);
-        local_tau_max = std::min(local_tau_max, tau);
-      }
+          /*
+           * Multirate: Rate levels are assigned in substep 0. In all
+           * other substeps we verify that the local time step size
+           * 2^l_i tau of a visited row is still admissible and request a
+           * restart of the cycle otherwise.
+           */
+          if (multirate) {
+            if (multirate_substep_ == 0)
+              write_entry<T>(rate_tau_, tau, i);
+            else if (any_less_than(tau, row_tau(T(), i)))
+              restart_needed = true;
+          }
+        }
+
+        if constexpr (std::is_same_v<T, Number>) {
+          local_tau_max = std::min(local_tau_max, local_tau_max_t);
+        } else {
+          for (unsigned int k = 0; k < T::size(); ++k)
+            local_tau_max = std::min(local_tau_max, local_tau_max_t[k]);
+        }
+      };
+
+      /* Parallel non-vectorized loop: */
+      loop(Number(), n_internal, n_owned);
+      /* Parallel vectorized SIMD loop: */
+      loop(VA(), 0, n_internal);
 
-      /* Synchronize tau max over all threads: */
-      Number current_tau_max = tau_max.load();
-      while (current_tau_max > local_tau_max &&
-             !tau_max.compare_exchange_weak(current_tau_max, local_tau_max))
-        ;
+      thread_tau_max[current_thread_number()] = local_tau_max;
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
+
+      /* Reduce the thread-local tau_max: */
+      const Number thread_reduced_tau_max =
+          *std::min_element(thread_tau_max.begin(), thread_tau_max.end());
+      tau_max.store(std::min(tau_max.load(), thread_reduced_tau_max));
+
+      if (keep_first_stage && first_stage) {
+        first_stage_U_ = old_U.begin();
+        first_stage_tau_bound_ = thread_reduced_tau_max / cfl_;
+      }
     }
 
+    /*
+     * Reduce tau_max over all MPI ranks with a non-blocking
+     * MPI_Iallreduce and only wait for the result when we need it:
+     *
+     *  - If tau is prescribed, we only need tau_max for the sanity check
+     *    at the end of the step.
+     *  - If the low-order update does not depend on tau in a nonlinear
+     *    fashion (no affine shift and no source terms) and we limit, then
+     *    step 4 stores the low-order increment (U_i^L - U_i) / tau in
+     *    new_U and step 5 forms U_i^L. The reduction thus overlaps with
+     *    step 4.
+     *  - Otherwise, we wait right away.
+     */
+
+    const bool defer_tau = tau == Number(0.) &&
+                           limiter_parameters_.iterations() != 0 &&
+                           !shallow_water && !View::have_source_terms;
+
+    /*
+     * Limiter slack probe (see limiter_slack_probe()): Under the same
+     * conditions the low-order update U_i^L depends linearly on tau, so
+     * that U_i + factor * (U_i^L - U_i) is the low-order update for the
+     * enlarged time step size factor * tau. The limiter bounds do not
+     * depend on tau.
+     */
+    const bool probe_slack = limiter_slack_probe_factor_ > Number(1.) &&
+                             limiter_parameters_.iterations() != 0 &&
+                             !multirate && !shallow_water &&
+                             !View::have_source_terms;
+    std::atomic<bool> slack_exhausted = false;
+
+    Number tau_max_global = tau_max.load();
+    MPI_Request tau_max_request = MPI_REQUEST_NULL;
     {
       Scope scope(computing_timer_,
                   "time step [H] _ - synchronization barriers");
 
-      /* MPI Barrier: */
-      tau_max.store(Utilities::MPI::min(tau_max.load(), mpi_communicator_));
+      const auto datatype =
+          std::is_same_v<Number, float> ? MPI_FLOAT : MPI_DOUBLE;
+      const int ierr = MPI_Iallreduce(MPI_IN_PLACE,
+                                      &tau_max_global,
+                                      1,
+                                      datatype,
+                                      MPI_MIN,
+                                      mpi_communicator_,
+                                      &tau_max_request);
+      AssertThrowMPI(ierr);
+    }
+
+    bool tau_max_synchronized = false;
+    const auto synchronize_tau_max = [&]() {
+      if (tau_max_synchronized)
+        return;
+      tau_max_synchronized = true;
+
+      Scope scope(computing_timer_,
+                  "time step [H] _ - synchronization barriers");
+
+      const int ierr = MPI_Wait(&tau_max_request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+      tau_max.store(tau_max_global);
 
       AssertThrow(
           !std::isnan(tau_max) && !std::isinf(tau_max) && tau_max > 0.,
@@ -577,16 +1260,207 @@ namespace ryujin
 
       tau = (tau == Number(0.) ? tau_max.load() : tau);
 
+      /*
+       * Multirate: (Re)assign rate levels at the beginning of a cycle. We
+       * have l_i <= log2(tau_i / tau) for the local CFL time step size
+       * tau_i. Thus, 2^l_i tau is an admissible local time step size.
+       */
+      if (multirate && multirate_substep_ == 0)
+        update_rate_levels(tau);
+
 #ifdef DEBUG_OUTPUT
       std::cout << "        computed tau_max = " << tau_max << std::endl;
       std::cout << "        perform time-step with tau = " << tau << std::endl;
 #endif
-    }
+    };
+
+#ifdef DEBUG
+    /*  Exchange d_ij so that we can check for symmetry: */
+    dij_matrix_.update_ghost_rows();
+#endif
+
+    if (tau == Number(0.) && !defer_tau)
+      synchronize_tau_max();
+
+    const Number weight =
+        -std::accumulate(stage_weights.begin(), stage_weights.end(), -1.);
+
+    /*
+     * Lambdas for (re)computing p_ij on the fly:
+     *
+     * If the "recompute p_ij" option is set we do not store the p_ij
+     * matrix in step 4 but recompute the low-order part of p_ij whenever
+     * it is needed in steps 5 - 7. The first lambda gathers all row
+     * dependent quantities (and returns an empty tuple if we store p_ij),
+     * the second lambda returns the contribution to p_ij of step 4 for a
+     * given column (either by recomputing it, or by loading it from the
+     * p_ij matrix), and the third lambda computes the mass matrix
+     * correction of step 5.
+     */
+
+    const auto p_ij_row_data =
+        [&](auto sentinel, auto recompute_p_ij, const unsigned int i) {
+          using T = decltype(sentinel);
+
+          if constexpr (recompute_p_ij) {
+            using View =
+                typename Description::template HyperbolicSystemView<dim, T>;
+            using flux_contribution_type =
+                typename View::flux_contribution_type;
+            using state_type = typename View::state_type;
+
+            const auto view = hyperbolic_system_->template view<dim, T>();
+
+            const auto U_i = old_U.template get_tensor<T>(i);
+            const auto alpha_i = get_entry<T>(alpha_, i);
+            const auto flux_i = view.flux_contribution(
+                old_precomputed, initial_precomputed_, i, U_i);
+
+            std::array<flux_contribution_type, stages> flux_iHs;
+            for (int s = 0; s < stages; ++s) {
+              const auto &[U_s, prec_s, V_s] = stage_state_vectors[s].get();
+              const auto U_iHs = U_s.template get_tensor<T>(i);
+              flux_iHs[s] = view.flux_contribution(
+                  prec_s, initial_precomputed_, i, U_iHs);
+            }
+
+            state_type S_i;
+            if constexpr (View::have_source_terms)
+              S_i = view.nodal_source(old_precomputed, i, U_i, tau);
+
+            return std::make_tuple(U_i, alpha_i, flux_i, flux_iHs, S_i);
+
+          } else {
+            return std::tuple<>();
+          }
+        };
+
+    const auto low_order_p_ij = [&](auto sentinel,
+                                    auto have_discontinuous_ansatz,
+                                    auto recompute_p_ij,
+                                    const auto &row_data,
+                                    const unsigned int i,
+                                    const unsigned int *js,
+                                    const unsigned int col_idx) {
+      using T = decltype(sentinel);
+
+      if constexpr (!recompute_p_ij) {
+        return pij_matrix_.template get_tensor<T>(i, col_idx);
+
+      } else {
+        using View =
+            typename Description::template HyperbolicSystemView<dim, T>;
+
+        const auto &[U_i, alpha_i, flux_i, flux_iHs, S_i] = row_data;
+
+        const auto view = hyperbolic_system_->template view<dim, T>();
+
+        const auto U_j = old_U.template get_tensor<T>(js);
+        const auto alpha_j = get_entry<T>(alpha_, js);
+
+        const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
+        auto factor = (alpha_i + alpha_j) * Number(.5);
+
+        if constexpr (have_discontinuous_ansatz) {
+          const auto incidence_ij =
+              incidence_matrix.template get_entry<T>(i, col_idx);
+          factor = std::max(factor, incidence_ij);
+        }
+
+        const auto d_ijH = d_ij * factor;
+
+        const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
+        const auto flux_j = view.flux_contribution(
+            old_precomputed, initial_precomputed_, js, U_j);
+
+        const auto flux_ij = view.flux_divergence(flux_i, flux_j, c_ij);
+        auto P_ij = -flux_ij;
+
+        if constexpr (shallow_water) {
+          const auto &[U_star_ij, U_star_ji] =
+              view.equilibrated_states(flux_i, flux_j);
+          P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
+        } else {
+          P_ij += (d_ijH - d_ij) * (U_j - U_i);
+        }
+
+        [[maybe_unused]] T m_ij;
+        if constexpr (View::have_source_terms) {
+          m_ij = mass_matrix.template get_entry<T>(i, col_idx);
+          P_ij -= m_ij * /*sic!*/ S_i;
+        }
+
+        if constexpr (View::have_high_order_flux) {
+          P_ij +=
+              weight * view.high_order_flux_divergence(flux_i, flux_j, c_ij);
+        } else {
+          P_ij += weight * flux_ij;
+        }
+
+        if constexpr (View::have_source_terms) {
+          const auto S_j = view.nodal_source(old_precomputed, js, U_j, tau);
+          P_ij += weight * m_ij * S_j;
+        }
+
+        for (int s = 0; s < stages; ++s) {
+          const auto &[U_s, prec_s, V_s] = stage_state_vectors[s].get();
+
+          const auto U_jHs = U_s.template get_tensor<T>(js);
+          const auto flux_jHs =
+              view.flux_contribution(prec_s, initial_precomputed_, js, U_jHs);
+
+          if constexpr (View::have_high_order_flux) {
+            P_ij += stage_weights[s] * view.high_order_flux_divergence(
+                                           flux_iHs[s], flux_jHs, c_ij);
+          } else {
+            P_ij += stage_weights[s] *
+                    view.flux_divergence(flux_iHs[s], flux_jHs, c_ij);
+          }
+
+          if constexpr (View::have_source_terms) {
+            const auto S_js = view.nodal_source(prec_s, js, U_jHs, tau);
+            P_ij += stage_weights[s] * m_ij * S_js;
+          }
+        }
+
+        return P_ij;
+      }
+    };
+
+    const auto p_ij_mass_correction = [&](auto have_discontinuous_ansatz,
+                                          const unsigned int i,
+                                          const unsigned int *js,
+                                          const unsigned int col_idx,
+                                          const auto &F_iH,
+                                          const auto &m_i,
+                                          const auto &m_i_inv) {
+      using T = std::decay_t<decltype(m_i_inv)>;
+
+      const auto F_jH = r_.template get_tensor<T>(js);
+      const auto kronecker_ij = col_idx == 0 ? T(1.) : T(0.);
+
+      if constexpr (have_discontinuous_ansatz) {
+        /* Use full consistent mass matrix inverse: */
+
+        const auto m_j = get_entry<T>(lumped_mass_matrix, js);
+        const auto m_ij_inv =
+            mass_matrix_inverse.template get_entry<T>(i, col_idx);
+        const auto b_ij = m_i * m_ij_inv - kronecker_ij;
+        const auto b_ji = m_j * m_ij_inv - kronecker_ij;
+
+        return b_ij * F_jH - b_ji * F_iH;
+
+      } else {
+        /* Use Neumann series expansion: */
+
+        const auto m_j_inv = get_entry<T>(lumped_mass_matrix_inverse, js);
+        const auto m_ij = mass_matrix.template get_entry<T>(i, col_idx);
+        const auto b_ij = kronecker_ij - m_ij * m_j_inv;
+        const auto b_ji = kronecker_ij - m_ij * m_i_inv;
 
-#ifdef DEBUG
-    /*  Exchange d_ij so that we can check for symmetry: */
-    dij_matrix_.update_ghost_rows();
-#endif
+        return b_ij * F_jH - b_ji * F_iH;
+      }
+    };
 
     /*
      * -------------------------------------------------------------------------
@@ -598,22 +1472,22 @@ namespace ryujin
       Scope scope(computing_timer_,
                   scoped_name("l.-o. update, compute bounds, r_i, and p_ij"));
 
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        r_.update_ghost_values_start(channel++);
-        r_.update_ghost_values_finish();
-        if (offline_data_->discretization().have_discontinuous_ansatz()) {
-          /*
-           * In case we extend bounds over the stencil, we have to ensure
-           * that ghost ranges are properly communicated over all MPI
-           * ranks.
-           */
-          bounds_.update_ghost_values_start(channel++);
-          bounds_.update_ghost_values_finish();
-        }
-      });
-
-      const Number weight =
-          -std::accumulate(stage_weights.begin(), stage_weights.end(), -1.);
+      SynchronizationDispatch synchronization_dispatch(
+          [&]() {
+            if (offline_data_->discretization().have_discontinuous_ansatz()) {
+              /*
+               * In case we extend bounds over the stencil, we have to ensure
+               * that ghost ranges are properly communicated over all MPI
+               * ranks. Both vectors are sent in a single message per
+               * neighboring rank.
+               */
+              ghost_exchange_.start({&r_, &bounds_}, channel++);
+            } else {
+              ghost_exchange_.start(r_, channel++);
+            }
+            ghost_exchange_.finish();
+          },
+          &communication_statistics_);
 
       /* Parallel region */
       RYUJIN_PARALLEL_REGION_BEGIN
@@ -637,25 +1511,33 @@ namespace ryujin
         /* Stored thread locally: */
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
+        AlignedVector<unsigned int> column_buffer;
         bool thread_ready = false;
 
-        RYUJIN_OMP_FOR
+        select_loop_schedule<T, Number>(tail_loop_schedule_,
+                                        tail_loop_chunk_size_);
+        thread_load_statistics_.loop_begin();
+
+        RYUJIN_OMP_FOR_RUNTIME_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
           const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
+          if (row_length == 1 || skip_row(i))
             continue;
 
           synchronization_dispatch.check(
               thread_ready, i >= n_export_indices && i < n_internal);
 
           const auto U_i = old_U.template get_tensor<T>(i);
-          auto U_i_new = U_i;
+
+          /* Store the low-order increment if tau is not yet known: */
+          auto U_i_new = defer_tau ? state_type() : U_i;
 
           const auto alpha_i = get_entry<T>(alpha_, i);
           const auto m_i = get_entry<T>(lumped_mass_matrix, i);
           const auto m_i_inv = get_entry<T>(lumped_mass_matrix_inverse, i);
+          const auto tau_i = defer_tau ? T(1.) : row_tau(T(), i);
 
           const auto flux_i = view.flux_contribution(
               old_precomputed, initial_precomputed_, i, U_i);
@@ -682,7 +1564,7 @@ namespace ryujin
           if constexpr (View::have_source_terms) {
             S_i = view.nodal_source(old_precomputed, i, U_i, tau);
             S_iH += weight * S_i;
-            U_i_new += tau * /* m_i_inv * m_i */ S_i;
+            U_i_new += tau_i * /* m_i_inv * m_i */ S_i;
             F_iH += m_i * S_iH;
           }
 
@@ -696,7 +1578,8 @@ namespace ryujin
            * before we can compute limiter bounds.
            */
 
-          const unsigned int *js = sparsity_simd.columns(i);
+          const unsigned int *js_row = sparsity_simd.columns(i, column_buffer);
+          const unsigned int *js = js_row;
           if constexpr (shallow_water) {
             for (unsigned int col_idx = 0; col_idx < row_length;
                  ++col_idx, js += stride_size) {
@@ -712,14 +1595,14 @@ namespace ryujin
               affine_shift += B_ij;
             }
 
-            affine_shift *= tau * m_i_inv;
+            affine_shift *= tau_i * m_i_inv;
           }
 
           if constexpr (View::have_source_terms) {
-            affine_shift += tau * /* m_i_inv * m_i */ S_i;
+            affine_shift += tau_i * /* m_i_inv * m_i */ S_i;
           }
 
-          js = sparsity_simd.columns(i);
+          js = js_row;
           for (unsigned int col_idx = 0; col_idx < row_length;
                ++col_idx, js += stride_size) {
 
@@ -767,7 +1650,7 @@ namespace ryujin
              */
 
             const auto flux_ij = view.flux_divergence(flux_i, flux_j, c_ij);
-            U_i_new += tau * m_i_inv * flux_ij;
+            U_i_new += tau_i * m_i_inv * flux_ij;
             auto P_ij = -flux_ij;
 
             if constexpr (shallow_water) {
@@ -778,7 +1661,7 @@ namespace ryujin
               const auto &[U_star_ij, U_star_ji] =
                   view.equilibrated_states(flux_i, flux_j);
 
-              U_i_new += tau * m_i_inv * d_ij * (U_star_ji - U_star_ij);
+              U_i_new += tau_i * m_i_inv * d_ij * (U_star_ji - U_star_ij);
               F_iH += d_ijH * (U_star_ji - U_star_ij);
               P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
 
@@ -787,7 +1670,7 @@ namespace ryujin
 
             } else {
 
-              U_i_new += tau * m_i_inv * d_ij * (U_j - U_i);
+              U_i_new += tau_i * m_i_inv * d_ij * (U_j - U_i);
               F_iH += d_ijH * (U_j - U_i);
               P_ij += (d_ijH - d_ij) * (U_j - U_i);
 
@@ -845,22 +1728,29 @@ namespace ryujin
               }
             }
 
-            pij_matrix_.write_entry(P_ij, i, col_idx, true);
+            if (!recompute_pij_)
+              pij_matrix_.write_entry(P_ij, i, col_idx, true);
           }
 
 #ifdef EXPENSIVE_BOUNDS_CHECK
-          if (!view.is_admissible(U_i_new)) {
+          if (!defer_tau && !view.is_admissible(U_i_new)) {
             restart_needed = true;
           }
 #endif
 
           new_U.template write_tensor<T>(U_i_new, i);
+          if (fuse_precomputation && limiter_parameters_.iterations() == 0)
+            write_precomputed(T(), U_i_new, i);
           r_.template write_tensor<T>(F_iH, i);
 
           const auto hd_i = m_i * measure_of_omega_inverse;
           const auto relaxed_bounds = limiter.bounds(hd_i);
           bounds_.template write_tensor<T>(relaxed_bounds, i);
         }
+
+        thread_load_statistics_.loop_end();
+        RYUJIN_OMP_BARRIER
+        thread_load_statistics_.barrier_end();
       };
 
       /*
@@ -883,25 +1773,47 @@ namespace ryujin
       RYUJIN_PARALLEL_REGION_END
     }
 
+    if (defer_tau)
+      synchronize_tau_max();
+
     /*
      * -------------------------------------------------------------------------
      * Step 5: Compute second part of P_ij, and l_ij (first round):
      * -------------------------------------------------------------------------
      */
 
+    /*
+     * With two limiter iterations the second pass has to load (or
+     * recompute) every p_ij anyway, and the fused update would only add a
+     * write of new_U. We thus fuse for a single iteration only:
+     */
+    const bool fuse_high_order_update =
+        fuse_high_order_update_ && limiter_parameters_.iterations() == 1;
+
     if (limiter_parameters_.iterations() != 0) {
       Scope scope(computing_timer_, scoped_name("compute p_ij, and l_ij"));
 
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        lij_matrix_.update_ghost_rows_start(channel++);
-        lij_matrix_.update_ghost_rows_finish();
-      });
+      /*
+       * The fused high-order update already uses the l_ij that are about
+       * to be exchanged, so we cannot round them afterwards:
+       */
+      const auto lij_precision = fuse_high_order_update
+                                     ? PayloadPrecision::full
+                                     : ghost_payload_precision_;
+
+      SynchronizationDispatch synchronization_dispatch(
+          [&]() {
+            lij_matrix_.update_ghost_rows_start(channel++, lij_precision);
+            lij_matrix_.update_ghost_rows_finish();
+          },
+          &communication_statistics_);
 
       RYUJIN_PARALLEL_REGION_BEGIN
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
       auto loop = [&](auto sentinel,
                       auto have_discontinuous_ansatz,
+                      auto recompute_p_ij,
                       unsigned int left,
                       unsigned int right) {
         using T = decltype(sentinel);
@@ -914,14 +1826,19 @@ namespace ryujin
         /* Stored thread locally: */
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
+        AlignedVector<unsigned int> column_buffer;
         bool thread_ready = false;
 
-        RYUJIN_OMP_FOR
+        select_loop_schedule<T, Number>(tail_loop_schedule_,
+                                        tail_loop_chunk_size_);
+        thread_load_statistics_.loop_begin();
+
+        RYUJIN_OMP_FOR_RUNTIME_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
           const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
+          if (row_length == 1 || skip_row(i))
             continue;
 
           synchronization_dispatch.check(
@@ -930,6 +1847,8 @@ namespace ryujin
           auto bounds =
               bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
 
+          const unsigned int *js_row = sparsity_simd.columns(i, column_buffer);
+
           /*
            * In case of a discontinuous finite element ansatz we need to
            * extend bounds over the stencil. We do this by looping over the
@@ -937,7 +1856,7 @@ namespace ryujin
            */
           if constexpr (have_discontinuous_ansatz) {
             /* Skip diagonal. */
-            const unsigned int *js = sparsity_simd.columns(i) + stride_size;
+            const unsigned int *js = js_row + stride_size;
             for (unsigned int col_idx = 1; col_idx < row_length;
                  ++col_idx, js += stride_size) {
               bounds = Limiter::combine_bounds(
@@ -952,51 +1871,68 @@ namespace ryujin
             m_i = get_entry<T>(lumped_mass_matrix, i);
           const auto m_i_inv = get_entry<T>(lumped_mass_matrix_inverse, i);
 
-          const auto U_i_new = new_U.template get_tensor<T>(i);
+          auto U_i_new = new_U.template get_tensor<T>(i);
+
+          /* Form the low-order update from the increment of step 4: */
+          if (defer_tau) {
+            const auto U_i = old_U.template get_tensor<T>(i);
+            U_i_new = U_i + row_tau(T(), i) * U_i_new;
+            new_U.template write_tensor<T>(U_i_new, i);
+
+#ifdef EXPENSIVE_BOUNDS_CHECK
+            const auto view = hyperbolic_system_->template view<dim, T>();
+            if (!view.is_admissible(U_i_new)) {
+              restart_needed = true;
+            }
+#endif
+          }
+
+          if (probe_slack) {
+            using state_type = typename View::state_type;
+            const auto U_i = old_U.template get_tensor<T>(i);
+            const auto U_i_probe =
+                U_i + T(limiter_slack_probe_factor_) * (U_i_new - U_i);
+            const auto success =
+                std::get<1>(limiter.limit(bounds, U_i_probe, state_type()));
+            if (!success)
+              slack_exhausted = true;
+          }
 
           const auto F_iH = r_.template get_tensor<T>(i);
 
           const auto lambda_inv = Number(row_length - 1);
-          const auto factor = tau * m_i_inv * lambda_inv;
+          const auto factor = row_tau(T(), i) * m_i_inv * lambda_inv;
+
+          /* Fused high-order update, see step 6: */
+          [[maybe_unused]] auto U_i_high = U_i_new;
+          const Number lambda = Number(1.) / lambda_inv;
+
+          [[maybe_unused]] const auto row_data =
+              p_ij_row_data(T(), recompute_p_ij, i);
 
           /* Skip diagonal. */
-          const unsigned int *js = sparsity_simd.columns(i) + stride_size;
+          const unsigned int *js = js_row + stride_size;
           for (unsigned int col_idx = 1; col_idx < row_length;
                ++col_idx, js += stride_size) {
 
-            auto P_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
-            const auto F_jH = r_.template get_tensor<T>(js);
+            auto P_ij = low_order_p_ij(T(),
+                                       have_discontinuous_ansatz,
+                                       recompute_p_ij,
+                                       row_data,
+                                       i,
+                                       js,
+                                       col_idx);
 
             /*
              * Mass matrix correction:
              */
 
-            const auto kronecker_ij = col_idx == 0 ? T(1.) : T(0.);
-
-            if constexpr (have_discontinuous_ansatz) {
-              /* Use full consistent mass matrix inverse: */
-
-              const auto m_j = get_entry<T>(lumped_mass_matrix, js);
-              const auto m_ij_inv =
-                  mass_matrix_inverse.template get_entry<T>(i, col_idx);
-              const auto b_ij = m_i * m_ij_inv - kronecker_ij;
-              const auto b_ji = m_j * m_ij_inv - kronecker_ij;
-
-              P_ij += b_ij * F_jH - b_ji * F_iH;
-
-            } else {
-              /* Use Neumann series expansion: */
-
-              const auto m_j_inv = get_entry<T>(lumped_mass_matrix_inverse, js);
-              const auto m_ij = mass_matrix.template get_entry<T>(i, col_idx);
-              const auto b_ij = kronecker_ij - m_ij * m_j_inv;
-              const auto b_ji = kronecker_ij - m_ij * m_i_inv;
-
-              P_ij += b_ij * F_jH - b_ji * F_iH;
-            }
+            P_ij += p_ij_mass_correction(
+                have_discontinuous_ansatz, i, js, col_idx, F_iH, m_i, m_i_inv);
 
             P_ij *= factor;
-            pij_matrix_.write_entry(P_ij, i, col_idx);
+            if constexpr (!recompute_p_ij)
+              pij_matrix_.write_entry(P_ij, i, col_idx);
 
             /*
              * Compute limiter coefficients:
@@ -1005,6 +1941,9 @@ namespace ryujin
             const auto &[l_ij, success] = limiter.limit(bounds, U_i_new, P_ij);
             lij_matrix_.template write_entry<T>(l_ij, i, col_idx, true);
 
+            if (fuse_high_order_update)
+              U_i_high += l_ij * lambda * P_ij;
+
             /*
              * If the success is set to false then the low-order update
              * resulted in a state outside of the limiter bounds. This can
@@ -1017,23 +1956,44 @@ namespace ryujin
             if (!success)
               restart_needed = true;
           }
+
+          if (fuse_high_order_update)
+            new_U.template write_tensor<T>(U_i_high, i);
         }
+
+        thread_load_statistics_.loop_end();
+        RYUJIN_OMP_BARRIER
+        thread_load_statistics_.barrier_end();
       };
 
       /*
-       * Chain through a compile time integral constant std::true_type for
-       * a discontinuous ansatz and std::false_type otherwise. We use the
-       * (constexpr) integral constant later on to avoid branching when
-       * computing d_ijH.
+       * Chain through compile time integral constants std::true_type for
+       * a discontinuous ansatz (and for recomputing p_ij) and
+       * std::false_type otherwise. We use the (constexpr) integral
+       * constants later on to avoid branching when computing d_ijH and
+       * p_ij.
        */
-      if (offline_data_->discretization().have_discontinuous_ansatz()) {
+      const auto dispatch = [&](auto have_discontinuous_ansatz,
+                                auto recompute_p_ij) {
         /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::true_type{}, n_internal, n_owned);
-        loop(VA(), std::true_type{}, 0, n_internal);
+        loop(Number(),
+             have_discontinuous_ansatz,
+             recompute_p_ij,
+             n_internal,
+             n_owned);
+        loop(VA(), have_discontinuous_ansatz, recompute_p_ij, 0, n_internal);
+      };
+
+      if (offline_data_->discretization().have_discontinuous_ansatz()) {
+        if (recompute_pij_)
+          dispatch(std::true_type{}, std::true_type{});
+        else
+          dispatch(std::true_type{}, std::false_type{});
       } else {
-        /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::false_type{}, n_internal, n_owned);
-        loop(VA(), std::false_type{}, 0, n_internal);
+        if (recompute_pij_)
+          dispatch(std::false_type{}, std::true_type{});
+        else
+          dispatch(std::false_type{}, std::false_type{});
       }
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
@@ -1051,8 +2011,30 @@ namespace ryujin
      */
 
     const auto n_iterations = limiter_parameters_.iterations();
+
+    /*
+     * Active set: If the first limiter pass leaves row i unlimited (that
+     * is, all symmetrized l_ij = 1), then all entries (1 - l_ij) * l_ij^(2)
+     * of that row and the corresponding transposed entries vanish. The
+     * second limiter pass and the final high-order update only need to
+     * visit rows with at least one l_ij < 1. Every thread records such
+     * rows in its own work list during the first pass.
+     */
+    const bool use_active_set = limiter_active_set_ && n_iterations == 2;
+
     for (unsigned int pass = 0; pass < n_iterations; ++pass) {
       bool last_round = (pass + 1 == n_iterations);
+      const bool record_active_set = use_active_set && !last_round;
+      const bool restrict_to_active_set = use_active_set && last_round;
+
+      /*
+       * Fused high-order update: Step 5 already accumulated
+       * U_i_new += l_ij * lambda * p_ij with the non-symmetrized l_ij. We
+       * thus only subtract (l_ij - min(l_ij, l_ji)) * lambda * p_ij,
+       * which vanishes for most entries. In the last round we can skip
+       * loading (or recomputing) p_ij for such entries altogether.
+       */
+      const bool correct_fused_update = fuse_high_order_update && pass == 0;
 
       std::string additional_step = (last_round ? "" : ", next l_ij");
       Scope scope(
@@ -1063,37 +2045,48 @@ namespace ryujin
         std::swap(lij_matrix_, lij_matrix_next_);
       }
 
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        if (!last_round) {
-          lij_matrix_next_.update_ghost_rows_start(channel++);
-          lij_matrix_next_.update_ghost_rows_finish();
-        }
-      });
+      SynchronizationDispatch synchronization_dispatch(
+          [&]() {
+            if (!last_round) {
+              lij_matrix_next_.update_ghost_rows_start(
+                  channel++, ghost_payload_precision_);
+              lij_matrix_next_.update_ghost_rows_finish();
+            }
+          },
+          &communication_statistics_);
 
       RYUJIN_PARALLEL_REGION_BEGIN
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
-      auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+      auto loop = [&](auto sentinel,
+                      auto have_discontinuous_ansatz,
+                      auto recompute_p_ij,
+                      unsigned int left,
+                      unsigned int right) {
         using T = decltype(sentinel);
         using View =
             typename Description::template HyperbolicSystemView<dim, T>;
         using Limiter = typename Description::template Limiter<dim, T>;
+        using state_type = typename View::state_type;
 
         unsigned int stride_size = get_stride_size<T>;
 
         /* Stored thread locally: */
         AlignedVector<T> lij_row;
+        [[maybe_unused]] AlignedVector<state_type> pij_row;
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
+        AlignedVector<unsigned int> column_buffer;
         bool thread_ready = false;
+        auto &active_rows = limiter_active_rows_[current_thread_number()];
+        if (record_active_set && std::is_same_v<T, Number>)
+          active_rows.clear();
 
-        RYUJIN_OMP_FOR
-        for (unsigned int i = left; i < right; i += stride_size) {
-
+        const auto process_row = [&](const unsigned int i) {
           /* Skip constrained degrees of freedom: */
           const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
-            continue;
+          if (row_length == 1 || skip_row(i))
+            return;
 
           synchronization_dispatch.check(
               thread_ready, i >= n_export_indices && i < n_internal);
@@ -1103,19 +2096,73 @@ namespace ryujin
           const Number lambda = Number(1.) / Number(row_length - 1);
           lij_row.resize_fast(row_length);
 
+          [[maybe_unused]] const auto row_data =
+              p_ij_row_data(T(), recompute_p_ij, i);
+          [[maybe_unused]] T m_i;
+          [[maybe_unused]] T m_i_inv;
+          [[maybe_unused]] T factor;
+          [[maybe_unused]] state_type F_iH;
+
+          if constexpr (recompute_p_ij) {
+            pij_row.resize_fast(row_length);
+            if constexpr (have_discontinuous_ansatz)
+              m_i = get_entry<T>(lumped_mass_matrix, i);
+            m_i_inv = get_entry<T>(lumped_mass_matrix_inverse, i);
+            F_iH = r_.template get_tensor<T>(i);
+            factor = row_tau(T(), i) * m_i_inv * Number(row_length - 1);
+          }
+
+          [[maybe_unused]] bool row_limited = false;
+
           /* Skip diagonal. */
-          for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+          const unsigned int *js =
+              sparsity_simd.columns(i, column_buffer) + stride_size;
+          for (unsigned int col_idx = 1; col_idx < row_length;
+               ++col_idx, js += stride_size) {
 
+            const auto l_ij_row = lij_matrix_.template get_entry<T>(i, col_idx);
             const auto l_ij = std::min(
-                lij_matrix_.template get_entry<T>(i, col_idx),
+                l_ij_row,
                 lij_matrix_.template get_transposed_entry<T>(i, col_idx));
 
-            const auto p_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
+            const bool need_p_ij = !last_round || !correct_fused_update ||
+                                   any_less_than(l_ij, l_ij_row);
+
+            if (need_p_ij) {
+              state_type p_ij;
+              if constexpr (recompute_p_ij) {
+                p_ij = low_order_p_ij(T(),
+                                      have_discontinuous_ansatz,
+                                      recompute_p_ij,
+                                      row_data,
+                                      i,
+                                      js,
+                                      col_idx);
+                p_ij += p_ij_mass_correction(have_discontinuous_ansatz,
+                                             i,
+                                             js,
+                                             col_idx,
+                                             F_iH,
+                                             m_i,
+                                             m_i_inv);
+                p_ij *= factor;
+                if (!last_round)
+                  pij_row[col_idx] = p_ij;
+              } else {
+                p_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
+              }
 
-            U_i_new += l_ij * lambda * p_ij;
+              if (correct_fused_update)
+                U_i_new -= (l_ij_row - l_ij) * lambda * p_ij;
+              else
+                U_i_new += l_ij * lambda * p_ij;
+            }
 
-            if (!last_round)
+            if (!last_round) {
               lij_row[col_idx] = l_ij;
+              if (record_active_set)
+                row_limited = row_limited || any_less_than(l_ij, T(1.));
+            }
           }
 
 #ifdef EXPENSIVE_BOUNDS_CHECK
@@ -1128,8 +2175,26 @@ namespace ryujin
           new_U.template write_tensor<T>(U_i_new, i);
 
           /* Skip computating l_ij and updating p_ij in the last round */
-          if (last_round)
-            continue;
+          if (last_round) {
+            if (fuse_precomputation)
+              write_precomputed(T(), U_i_new, i);
+            return;
+          }
+
+          /*
+           * Unlimited row: all entries (1 - l_ij) * l_ij^(2) vanish, so
+           * we simply write zeros and skip the second limiter pass.
+           */
+          if (record_active_set) {
+            if (!row_limited) {
+              for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx)
+                lij_matrix_next_.write_entry(T(0.), i, col_idx, true);
+              if (fuse_precomputation)
+                write_precomputed(T(), U_i_new, i);
+              return;
+            }
+            active_rows.push_back(i);
+          }
 
           const auto bounds =
               bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
@@ -1138,9 +2203,13 @@ namespace ryujin
 
             const auto old_l_ij = lij_row[col_idx];
 
-            const auto new_p_ij =
-                (T(1.) - old_l_ij) *
-                pij_matrix_.template get_tensor<T>(i, col_idx);
+            state_type p_ij;
+            if constexpr (recompute_p_ij)
+              p_ij = pij_row[col_idx];
+            else
+              p_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
+
+            const auto new_p_ij = (T(1.) - old_l_ij) * p_ij;
 
             const auto &[new_l_ij, success] =
                 limiter.limit(bounds, U_i_new, new_p_ij);
@@ -1169,32 +2238,104 @@ namespace ryujin
             const auto entry = (T(1.) - old_l_ij) * new_l_ij;
             lij_matrix_next_.write_entry(entry, i, col_idx, true);
           }
+        };
+
+        select_loop_schedule<T, Number>(tail_loop_schedule_,
+                                        tail_loop_chunk_size_);
+        thread_load_statistics_.loop_begin();
+
+        if (restrict_to_active_set) {
+          /*
+           * Visit the rows recorded by this thread during the first
+           * pass. The work list contains indices of the non-vectorized
+           * range as well as (strides of) the vectorized range.
+           */
+          for (const auto i : active_rows)
+            if (i >= left && i < right)
+              process_row(i);
+
+        } else {
+          RYUJIN_OMP_FOR_RUNTIME_NOWAIT
+          for (unsigned int i = left; i < right; i += stride_size)
+            process_row(i);
         }
+
+        thread_load_statistics_.loop_end();
+        RYUJIN_OMP_BARRIER
+        thread_load_statistics_.barrier_end();
       };
 
-      /* Parallel non-vectorized loop: */
-      loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
+      /*
+       * Chain through compile time integral constants (see step 5):
+       */
+      const auto dispatch = [&](auto have_discontinuous_ansatz,
+                                auto recompute_p_ij) {
+        /* Parallel non-vectorized loop and vectorized SIMD loop: */
+        loop(Number(),
+             have_discontinuous_ansatz,
+             recompute_p_ij,
+             n_internal,
+             n_owned);
+        loop(VA(), have_discontinuous_ansatz, recompute_p_ij, 0, n_internal);
+      };
+
+      if (offline_data_->discretization().have_discontinuous_ansatz()) {
+        if (recompute_pij_)
+          dispatch(std::true_type{}, std::true_type{});
+        else
+          dispatch(std::true_type{}, std::false_type{});
+      } else {
+        if (recompute_pij_)
+          dispatch(std::false_type{}, std::true_type{});
+        else
+          dispatch(std::false_type{}, std::false_type{});
+      }
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
     } /* limiter_iter_ */
 
+    /*
+     * Multirate: Rows that are skipped in subsequent substeps still have
+     * to find their l_ij of both limiter passes in the same matrices. We
+     * thus undo the swap of the last limiter pass.
+     */
+    if (multirate && n_iterations == 2)
+      std::swap(lij_matrix_, lij_matrix_next_);
+
     CALLGRIND_STOP_INSTRUMENTATION;
 
     /*
      * Do we have to restart?
      */
 
+    synchronize_tau_max();
+
     {
       Scope scope(computing_timer_,
                   "time step [H] _ - synchronization barriers");
 
-      restart_needed.store(
-          Utilities::MPI::logical_or(restart_needed.load(), mpi_communicator_));
+      if (probe_slack) {
+        /* Reduce both flags with a single collective operation: */
+        const auto flags = Utilities::MPI::max(
+            std::vector<unsigned int>{restart_needed.load(),
+                                      slack_exhausted.load()},
+            mpi_communicator_);
+        restart_needed.store(flags[0] != 0);
+        limiter_slack_exhausted_ = limiter_slack_exhausted_ || flags[1] != 0;
+      } else {
+        restart_needed.store(Utilities::MPI::logical_or(restart_needed.load(),
+                                                        mpi_communicator_));
+      }
+    }
+
+    if (swap_stage_data) {
+      std::swap(dij_matrix_, dij_matrix_scratch_);
+      alpha_.swap(alpha_scratch_);
     }
 
+    fused_precomputation_U_ = fuse_precomputation ? new_U.begin() : nullptr;
+
     if (restart_needed) {
       switch (id_violation_strategy_) {
       case IDViolationStrategy::warn:
@@ -1210,4 +2351,330 @@ namespace ryujin
     return tau;
   }
 
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::update_rate_levels(
+      const Number tau_min) const
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "HyperbolicModule<Description, dim, Number>::"
+              << "update_rate_levels()" << std::endl;
+#endif
+
+    const unsigned int n_internal = offline_data_->n_locally_internal();
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+    constexpr auto simd_length = VectorizedArray<Number>::size();
+
+    const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
+
+    /*
+     * Assign rate levels l_i = min(L, floor(log2(tau_i / tau_min))).
+     * Constrained degrees of freedom and degrees of freedom with a
+     * boundary condition are kept on level 0: boundary conditions are
+     * enforced in every substep.
+     */
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      unsigned int level = 0;
+      if (sparsity_simd.row_length(i) != 1) {
+        const Number ratio = rate_tau_.local_element(i) / tau_min;
+        if (ratio >= Number(2.))
+          level = std::min(n_rate_levels_,
+                           static_cast<unsigned int>(std::log2(ratio)));
+      }
+      rate_scratch_.local_element(i) = Number(level);
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+
+    const auto &boundary_map = offline_data_->boundary_map();
+    for (const auto &[first, last] : boundary_ranges_) {
+      const auto i = std::get<0>(boundary_map[boundary_permutation_[first]]);
+      if (i < n_owned)
+        rate_scratch_.local_element(i) = Number(0.);
+    }
+
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      const auto level = static_cast<std::uint8_t>(
+          rate_scratch_.local_element(i));
+      rate_levels_[i] = level;
+      rate_factor_.local_element(i) = Number(1u << level);
+    }
+
+    /*
+     * The activity level a_i is the minimal rate level within the
+     * distance-(1 + limiter iterations) neighborhood of row i: all data
+     * that enters the limited update of an edge (i, j) is computed from
+     * states within this neighborhood of i and j.
+     */
+
+    const unsigned int n_sweeps = 1 + limiter_parameters_.iterations();
+    for (unsigned int sweep = 0; sweep < n_sweeps; ++sweep) {
+      rate_scratch_.update_ghost_values();
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      AlignedVector<unsigned int> column_buffer;
+
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        Number activity = rate_scratch_.local_element(i);
+
+        const unsigned int row_length = sparsity_simd.row_length(i);
+        const unsigned int *js = sparsity_simd.columns(i, column_buffer);
+        for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+          const auto j =
+              *(i < n_internal ? js + col_idx * simd_length : js + col_idx);
+          activity = std::min(activity, rate_scratch_.local_element(j));
+        }
+
+        rate_scratch_next_.local_element(i) = activity;
+      }
+
+      RYUJIN_PARALLEL_REGION_END
+
+      rate_scratch_.swap(rate_scratch_next_);
+    }
+
+    /*
+     * All rows of a SIMD stride are visited together. We thus also store
+     * the minimal activity level of the stride of every row.
+     */
+
+    for (unsigned int i = 0; i < n_owned; ++i)
+      rate_activity_[i] =
+          static_cast<std::uint8_t>(rate_scratch_.local_element(i));
+
+    std::copy(rate_activity_.begin(),
+              rate_activity_.end(),
+              rate_stride_activity_.begin());
+    for (unsigned int i = 0; i < n_internal; i += simd_length) {
+      const auto stride_begin = rate_stride_activity_.begin() + i;
+      const auto stride_end = stride_begin + simd_length;
+      std::fill(stride_begin,
+                stride_end,
+                *std::min_element(stride_begin, stride_end));
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::multirate_update(
+      StateVector &visible_state_vector,
+      StateVector &increment_state_vector,
+      const StateVector &substep_state_vector) const
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "HyperbolicModule<Description, dim, Number>::"
+              << "multirate_update()" << std::endl;
+#endif
+
+    auto &visible_U = std::get<0>(visible_state_vector);
+    auto &increment_U = std::get<0>(increment_state_vector);
+    const auto &substep_U = std::get<0>(substep_state_vector);
+
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+    const unsigned int substep = multirate_substep_;
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      const unsigned int activity = rate_activity_[i];
+      const unsigned int level = rate_levels_[i];
+
+      /*
+       * Row i is visited on every substep divisible by 2^a_i and
+       * completes its local time step on the last substep of every
+       * interval of 2^l_i substeps. For a_i >= 1 the latter is never a
+       * visited substep, so both conditions have to be checked
+       * independently:
+       */
+      const bool visited = (substep & ((1u << activity) - 1u)) == 0;
+      const bool completed = ((substep + 1) & ((1u << level) - 1u)) == 0;
+      if (!visited && !completed)
+        continue;
+
+      const auto U_i = visible_U.get_tensor(i);
+      auto increment = increment_U.get_tensor(i);
+
+      if (visited) {
+        /*
+         * The increment of row i stays constant for the next 2^a_i
+         * substeps and was computed with a time step size of 2^l_i tau:
+         */
+        const Number weight = Number(1u << activity) / Number(1u << level);
+        increment += weight * (substep_U.get_tensor(i) - U_i);
+      }
+
+      if (completed) {
+        visible_U.write_tensor(U_i + increment, i);
+        increment = 0.;
+      }
+
+      increment_U.write_tensor(increment, i);
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::print_multirate_statistics(
+      std::ostream &output) const
+  {
+    if (n_rate_levels_ == 0)
+      return;
+
+    /*
+     * Count rows per rate level and the number of row visits per cycle of
+     * 2^L substeps (a row with activity level a_i is visited 2^(L - a_i)
+     * times):
+     */
+
+    std::vector<double> counts(n_rate_levels_ + 2, 0.);
+    for (unsigned int i = 0; i < rate_levels_.size(); ++i) {
+      counts[rate_levels_[i]] += 1.;
+      counts.back() += double(1u << (n_rate_levels_ - rate_activity_[i]));
+    }
+    counts = Utilities::MPI::sum(counts, mpi_communicator_);
+
+    const double n_rows = std::accumulate(counts.begin(), counts.end() - 1, 0.);
+    const double n_visits = n_rows * double(1u << n_rate_levels_);
+
+    output << "        [ multirate levels:" << std::setprecision(1)
+           << std::fixed;
+    for (unsigned int l = 0; l <= n_rate_levels_; ++l)
+      output << " " << 100. * counts[l] / std::max(n_rows, 1.) << "%";
+    output << ", row updates saved: "
+           << 100. * (1. - counts.back() / std::max(n_visits, 1.)) << "% ]"
+           << std::endl;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::print_page_placement(
+      std::ostream &output) const
+  {
+    if (!page_placement_report_)
+      return;
+
+    const auto &scalar_partitioner = offline_data_->scalar_partitioner();
+    const std::size_t alpha_size = scalar_partitioner->locally_owned_size() +
+                                   scalar_partitioner->n_ghost_indices();
+
+    std::vector<std::pair<std::string, std::vector<std::size_t>>> placements{
+        {"alpha_i", NUMA::page_placement(alpha_.begin(),
+                                         alpha_size * sizeof(Number))},
+        {"bounds_i", bounds_.page_placement()},
+        {"r_i", r_.page_placement()},
+        {"d_ij", dij_matrix_.page_placement()},
+        {"l_ij", lij_matrix_.page_placement()},
+        {"l_ij next", lij_matrix_next_.page_placement()},
+    };
+    if (!recompute_pij_)
+      placements.push_back({"p_ij", pij_matrix_.page_placement()});
+
+    /*
+     * Pad all histograms to a common number of NUMA nodes and accumulate
+     * over all MPI ranks. The last entry counts pages with unknown
+     * placement.
+     */
+
+    std::size_t n_nodes = 0;
+    for (const auto &it : placements)
+      n_nodes = std::max(n_nodes, it.second.size() - 1);
+    n_nodes = Utilities::MPI::max(n_nodes, mpi_communicator_);
+
+    for (auto &[name, counts] : placements) {
+      std::vector<std::size_t> padded(n_nodes + 1, 0);
+      std::copy(counts.begin(), counts.end() - 1, padded.begin());
+      padded.back() = counts.back();
+      counts.resize(n_nodes + 1);
+      Utilities::MPI::sum(padded, mpi_communicator_, counts);
+    }
+
+    if (Utilities::MPI::this_mpi_process(mpi_communicator_) != 0)
+      return;
+
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1);
+    stream << "\nPage placement: [pages per NUMA node, all ranks]";
+
+    for (const auto &[name, counts] : placements) {
+      const auto total =
+          std::accumulate(counts.begin(), counts.end(), std::size_t(0));
+      const double scale = 100. / std::max(total, std::size_t(1));
+
+      stream << "\n  " << std::left << std::setw(10) << name << std::right
+             << std::setw(10) << total << " pages:";
+      for (unsigned int node = 0; node < n_nodes; ++node)
+        stream << "  [n" << node << "] " << std::setw(5)
+               << counts[node] * scale << "%";
+      stream << "  [n/a] " << std::setw(5) << counts.back() * scale << "%";
+    }
+
+    output << stream.str() << std::endl;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::print_thread_statistics(
+      std::ostream &output) const
+  {
+    if (!thread_load_statistics_.enabled())
+      return;
+
+    const auto busy_times = thread_load_statistics_.busy_times();
+    const auto idle_times = thread_load_statistics_.idle_times();
+
+    double busy = 0.;
+    double idle = 0.;
+    double idle_fraction_max = 0.;
+    for (unsigned int k = 0; k < busy_times.size(); ++k) {
+      busy += busy_times[k];
+      idle += idle_times[k];
+      const double total = busy_times[k] + idle_times[k];
+      if (total > 0.)
+        idle_fraction_max = std::max(idle_fraction_max, idle_times[k] / total);
+    }
+    const double idle_fraction = busy + idle > 0. ? idle / (busy + idle) : 0.;
+
+    const auto idle_fraction_statistics =
+        Utilities::MPI::min_max_avg(idle_fraction, mpi_communicator_);
+    idle_fraction_max =
+        Utilities::MPI::max(idle_fraction_max, mpi_communicator_);
+
+    output << "        [ threads idle in barriers: " << std::setprecision(1)
+           << std::fixed << 100. * idle_fraction_statistics.avg << "% avg, "
+           << 100. * idle_fraction_statistics.max << "% max rank, "
+           << 100. * idle_fraction_max << "% max thread ]" << std::endl;
+  }
+
+
+
+  template <typename Description, int dim, typename Number>
+  void
+  HyperbolicModule<Description, dim, Number>::print_communication_statistics(
+      std::ostream &output) const
+  {
+    const double communication = Utilities::MPI::sum(
+        communication_statistics_.communication_time(), mpi_communicator_);
+    const double exposed = Utilities::MPI::sum(
+        communication_statistics_.exposed_time(), mpi_communicator_);
+
+    if (communication == 0.)
+      return;
+
+    const double hidden = std::max(communication - exposed, 0.);
+
+    output << "        [ communication hidden: " << std::setprecision(1)
+           << std::fixed << 100. * hidden / communication << "% ("
+           << std::setprecision(2) << std::scientific << exposed
+           << "s exposed of " << communication << "s total) ]" << std::endl;
+  }
+
 } /* namespace ryujin */
@@ -6,13 +6,20 @@
 #pragma once
 
 #include <deal.II/base/partitioner.h>
+#include <deal.II/base/utilities.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/dofs/dof_renumbering.h>
 #include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/mapping.h>
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/sparsity_tools.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <numeric>
+
 namespace ryujin
 {
   /**
@@ -88,6 +95,222 @@ namespace ryujin
      */
     using dealii::DoFRenumbering::Cuthill_McKee;
 
+
+    /**
+     * Return the (real) support points of all locally owned degrees of
+     * freedom in local numbering.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim>
+    std::vector<dealii::Point<dim>>
+    locally_owned_support_points(const dealii::DoFHandler<dim> &dof_handler,
+                                 const dealii::Mapping<dim> &mapping)
+    {
+      using namespace dealii;
+
+      const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+      const auto n_locally_owned = locally_owned.n_elements();
+
+      /* Offset to translate from global to local index range */
+      const auto offset = n_locally_owned != 0 ? *locally_owned.begin() : 0;
+
+      const auto &finite_element = dof_handler.get_fe();
+      AssertThrow(finite_element.has_support_points(),
+                  dealii::ExcMessage("Renumbering by support points requires "
+                                     "a finite element with support points"));
+
+      const auto unit_support_points = finite_element.get_unit_support_points();
+
+      std::vector<Point<dim>> points(n_locally_owned);
+      std::vector<types::global_dof_index> local_dof_indices(
+          finite_element.dofs_per_cell);
+
+      for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned())
+          continue;
+
+        cell->get_dof_indices(local_dof_indices);
+        for (unsigned int j = 0; j < local_dof_indices.size(); ++j) {
+          const auto global_index = local_dof_indices[j];
+          if (!locally_owned.is_element(global_index))
+            continue;
+          points[global_index - offset] =
+              mapping.transform_unit_to_real_cell(cell, unit_support_points[j]);
+        }
+      }
+
+      return points;
+    }
+
+
+    /**
+     * Reorder all locally owned degrees of freedom by sorting a given
+     * vector of @p keys (in local numbering) in ascending order. The sort
+     * is stable, i.e., degrees of freedom with identical keys retain their
+     * relative order.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim, typename Key>
+    void sort_by_keys(dealii::DoFHandler<dim> &dof_handler,
+                      const std::vector<Key> &keys)
+    {
+      using namespace dealii;
+
+      const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+      const auto n_locally_owned = locally_owned.n_elements();
+
+      /* The locally owned index range has to be contiguous */
+      Assert(locally_owned.is_contiguous() == true,
+             dealii::ExcMessage(
+                 "Need a contiguous set of locally owned indices."));
+      AssertDimension(keys.size(), n_locally_owned);
+
+      /* Offset to translate from global to local index range */
+      const auto offset = n_locally_owned != 0 ? *locally_owned.begin() : 0;
+
+      std::vector<unsigned int> permutation(n_locally_owned);
+      std::iota(permutation.begin(), permutation.end(), 0);
+      std::stable_sort(permutation.begin(),
+                       permutation.end(),
+                       [&](const auto left, const auto right) {
+                         return keys[left] < keys[right];
+                       });
+
+      std::vector<dealii::types::global_dof_index> new_order(n_locally_owned);
+      for (unsigned int i = 0; i < n_locally_owned; ++i)
+        new_order[permutation[i]] = offset + i;
+
+      dof_handler.renumber_dofs(new_order);
+    }
+
+
+    /**
+     * Reorder all locally owned degrees of freedom along a Hilbert space
+     * filling curve traversing their support points.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim>
+    void hilbert(dealii::DoFHandler<dim> &dof_handler,
+                 const dealii::Mapping<dim> &mapping)
+    {
+      using namespace dealii;
+
+      constexpr int bits_per_dim = 63 / dim;
+
+      const auto points = locally_owned_support_points(dof_handler, mapping);
+      const auto indices =
+          Utilities::inverse_Hilbert_space_filling_curve(points, bits_per_dim);
+
+      std::vector<std::uint64_t> keys(indices.size());
+      for (unsigned int i = 0; i < indices.size(); ++i)
+        keys[i] = Utilities::pack_integers<dim>(indices[i], bits_per_dim);
+
+      sort_by_keys(dof_handler, keys);
+    }
+
+
+    /**
+     * Reorder all locally owned degrees of freedom along a Morton (or
+     * Z-order) space filling curve traversing their support points.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim>
+    void morton(dealii::DoFHandler<dim> &dof_handler,
+                const dealii::Mapping<dim> &mapping)
+    {
+      using namespace dealii;
+
+      constexpr int bits_per_dim = 63 / dim;
+
+      const auto points = locally_owned_support_points(dof_handler, mapping);
+
+      /* Quantize coordinates relative to the local bounding box: */
+
+      Point<dim> lower;
+      Point<dim> upper;
+      if (!points.empty()) {
+        lower = upper = points[0];
+        for (const auto &point : points)
+          for (unsigned int d = 0; d < dim; ++d) {
+            lower[d] = std::min(lower[d], point[d]);
+            upper[d] = std::max(upper[d], point[d]);
+          }
+      }
+
+      const double max_coordinate = double((std::uint64_t(1) << bits_per_dim) -
+                                           std::uint64_t(1));
+
+      std::vector<std::uint64_t> keys(points.size());
+      for (unsigned int i = 0; i < points.size(); ++i) {
+        std::array<std::uint64_t, dim> coordinates;
+        for (unsigned int d = 0; d < dim; ++d) {
+          const double extent = upper[d] - lower[d];
+          const double scaled =
+              extent > 0. ? (points[i][d] - lower[d]) / extent : 0.;
+          coordinates[d] = static_cast<std::uint64_t>(scaled * max_coordinate);
+        }
+
+        /* Interleave bits, most significant bit first: */
+        std::uint64_t key = 0;
+        for (int b = bits_per_dim - 1; b >= 0; --b)
+          for (unsigned int d = 0; d < dim; ++d)
+            key = (key << 1) | ((coordinates[d] >> b) & std::uint64_t(1));
+        keys[i] = key;
+      }
+
+      sort_by_keys(dof_handler, keys);
+    }
+
+
+    /**
+     * Reorder all locally owned degrees of freedom cell by cell: We
+     * traverse all locally owned active cells in the order of the
+     * triangulation (which for a distributed triangulation follows the
+     * space filling curve of the p4est forest) and number all not yet
+     * enumerated degrees of freedom of a cell consecutively.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim>
+    void cell_wise(dealii::DoFHandler<dim> &dof_handler)
+    {
+      using namespace dealii;
+
+      const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+      const auto n_locally_owned = locally_owned.n_elements();
+
+      /* Offset to translate from global to local index range */
+      const auto offset = n_locally_owned != 0 ? *locally_owned.begin() : 0;
+
+      std::vector<unsigned int> keys(n_locally_owned,
+                                     numbers::invalid_unsigned_int);
+      std::vector<types::global_dof_index> local_dof_indices(
+          dof_handler.get_fe().dofs_per_cell);
+
+      unsigned int running_index = 0;
+      for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned())
+          continue;
+
+        cell->get_dof_indices(local_dof_indices);
+        for (const auto global_index : local_dof_indices) {
+          if (!locally_owned.is_element(global_index))
+            continue;
+          auto &key = keys[global_index - offset];
+          if (key == numbers::invalid_unsigned_int)
+            key = running_index++;
+        }
+      }
+
+      Assert(running_index == n_locally_owned, dealii::ExcInternalError());
+
+      sort_by_keys(dof_handler, keys);
+    }
+
     /**
      * Reorder all (strides of) locally internal indices that contain
      * export indices to the start of the index range.
@@ -369,6 +592,90 @@ namespace ryujin
       Assert(n_locally_internal % group_size == 0, ExcInternalError());
       return n_locally_internal;
     }
+
+
+    /**
+     * Extend the internal index range:
+     *
+     * Group all indices of the non-vectorized index range
+     * \f$[\text{n_locally_internal}, \text{n_locally_owned})\f$ that have
+     * the same stencil size into additional groups of @p group_size and
+     * append these groups to the internal index range. The order of
+     * \f$[0, \text{n_locally_internal})\f$ is left untouched. If no
+     * additional group can be formed the numbering is not changed.
+     *
+     * This function has to be called on all MPI ranks.
+     *
+     * Returns the new right boundary n_internal of the internal index
+     * range.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim>
+    unsigned int
+    extend_internal_range(dealii::DoFHandler<dim> &dof_handler,
+                          const dealii::DynamicSparsityPattern &sparsity,
+                          const unsigned int n_locally_internal,
+                          const std::size_t group_size)
+    {
+      using namespace dealii;
+
+      const auto &locally_owned = dof_handler.locally_owned_dofs();
+      const auto n_locally_owned = locally_owned.n_elements();
+
+      /* The locally owned index range has to be contiguous */
+
+      Assert(locally_owned.is_contiguous() == true,
+             dealii::ExcMessage(
+                 "Need a contiguous set of locally owned indices."));
+      Assert(n_locally_internal <= n_locally_owned, dealii::ExcInternalError());
+
+      /* Offset to translate from global to local index range */
+      const auto offset = n_locally_owned != 0 ? *locally_owned.begin() : 0;
+
+      using dof_type = dealii::types::global_dof_index;
+      std::vector<dof_type> new_order(n_locally_owned);
+      std::iota(new_order.begin(), new_order.end(), offset);
+      dof_type current_index = offset + n_locally_internal;
+
+      /*
+       * Sort the remaining degrees of freedom into bins grouped by stencil
+       * size and write out full groups of group_size:
+       */
+
+      std::map<unsigned int, std::vector<unsigned int>> bins;
+
+      for (unsigned int i = n_locally_internal; i < n_locally_owned; ++i) {
+        const unsigned int row_length = sparsity.row_length(offset + i);
+        auto &bin = bins[row_length];
+        bin.push_back(i);
+
+        if (bin.size() == group_size) {
+          for (const auto index : bin)
+            new_order[index] = current_index++;
+          bin.clear();
+        }
+      }
+
+      const unsigned int n_new_internal = current_index - offset;
+
+      if (n_new_internal != n_locally_internal) {
+        /* Write out the rest. */
+        for (const auto &entries : bins)
+          for (const auto index : entries.second)
+            new_order[index] = current_index++;
+        Assert(current_index == offset + n_locally_owned, ExcInternalError());
+
+      } else {
+        /* No additional groups: keep the numbering unchanged. */
+        std::iota(new_order.begin(), new_order.end(), offset);
+      }
+
+      dof_handler.renumber_dofs(new_order);
+
+      Assert(n_new_internal % group_size == 0, ExcInternalError());
+      return n_new_internal;
+    }
   } // namespace DoFRenumbering
 
 
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "numa.h"
 #include "simd.h"
 
 #include <deal.II/base/mpi.h>
@@ -79,6 +80,27 @@ namespace ryujin
        */
       using ScalarVector::operator=;
 
+      /**
+       * Set all locally owned and ghost entries to zero such that every
+       * memory page is first-touched by the thread that processes the
+       * corresponding elements in the compute kernels: The vectorized
+       * index range [0, @p n_internal) is distributed in strides of
+       * simd_length, the remaining locally owned elements one by one (see
+       * NUMA::first_touch()). If @p huge_pages is set to true, then the
+       * storage is advised to be backed by transparent huge pages.
+       *
+       * @note The function has to be called after reinit() and before
+       * any values are written.
+       */
+      void first_touch(const unsigned int n_internal,
+                       const bool huge_pages = false);
+
+      /**
+       * Return the number of memory pages of the locally owned and ghost
+       * range that reside on each NUMA node (see NUMA::page_placement()).
+       */
+      std::vector<std::size_t> page_placement() const;
+
       /**
        * Reinitializes the MultiComponentVector with a scalar MPI
        * partitioner. The function calls create_vector_partitioner()
@@ -204,6 +226,48 @@ namespace ryujin
     }
 
 
+    template <typename Number, int n_comp, int simd_length>
+    void MultiComponentVector<Number, n_comp, simd_length>::first_touch(
+        const unsigned int n_internal [[maybe_unused]],
+        const bool huge_pages [[maybe_unused]])
+    {
+      /* Special case of a zero component vector */
+      if constexpr (n_comp > 0) {
+        const auto &partitioner = this->get_partitioner();
+        const unsigned int n_owned =
+            partitioner->locally_owned_size() / n_comp;
+        const std::size_t size =
+            partitioner->locally_owned_size() + partitioner->n_ghost_indices();
+
+        Assert(n_internal <= n_owned, dealii::ExcInternalError());
+
+        const auto row_range = [](const unsigned int i, const unsigned int n) {
+          return std::make_pair(std::size_t(i) * n_comp,
+                                std::size_t(i + n) * n_comp);
+        };
+
+        NUMA::first_touch(this->begin(),
+                          size,
+                          n_internal,
+                          n_owned,
+                          simd_length,
+                          row_range,
+                          huge_pages);
+      }
+    }
+
+
+    template <typename Number, int n_comp, int simd_length>
+    std::vector<std::size_t>
+    MultiComponentVector<Number, n_comp, simd_length>::page_placement() const
+    {
+      const auto &partitioner = this->get_partitioner();
+      const std::size_t size =
+          partitioner->locally_owned_size() + partitioner->n_ghost_indices();
+      return NUMA::page_placement(this->begin(), size * sizeof(Number));
+    }
+
+
     template <typename Number, int n_comp, int simd_length>
     void MultiComponentVector<Number, n_comp, simd_length>::extract_component(
         ScalarVector &scalar_vector, unsigned int component) const
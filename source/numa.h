@@ -0,0 +1,209 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include "openmp.h"
+
+#include <deal.II/base/config.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ryujin
+{
+  /**
+   * Helper functions for controlling the placement of memory pages on
+   * NUMA systems.
+   *
+   * Linux places a page of (anonymous) memory on the NUMA node of the
+   * thread that first writes to it. Large arrays that are zero-initialized
+   * by a single thread thus end up on a single NUMA node. The functions in
+   * this namespace release already populated pages of an array and
+   * first-touch them again with the same static schedule that the compute
+   * kernels use.
+   *
+   * @ingroup Miscellaneous
+   */
+  namespace NUMA
+  {
+    namespace
+    {
+      /**
+       * Internally used: Return the range of full memory pages that lie
+       * within [data, data + size).
+       */
+      inline std::pair<char *, std::size_t> interior_pages(void *data,
+                                                           std::size_t size)
+      {
+#ifdef __linux__
+        const auto page_size = static_cast<std::uintptr_t>(getpagesize());
+        const auto begin = reinterpret_cast<std::uintptr_t>(data);
+        const auto end = begin + size;
+        const auto first = (begin + page_size - 1) / page_size * page_size;
+        const auto last = end / page_size * page_size;
+        if (last <= first)
+          return {nullptr, 0};
+        return {reinterpret_cast<char *>(first), last - first};
+#else
+        (void)data;
+        (void)size;
+        return {nullptr, 0};
+#endif
+      }
+    } // namespace
+
+
+    /**
+     * Release all full memory pages within [data, data + size) back to
+     * the operating system. The memory stays valid: the next write
+     * access to a released page allocates a new, zero-filled page on the
+     * NUMA node of the writing thread.
+     *
+     * @note This must only be used for private anonymous memory (as
+     * obtained by malloc() or posix_memalign()) and only for arrays whose
+     * content is subsequently overwritten with zeros.
+     */
+    inline void release_pages(void *data [[maybe_unused]],
+                              std::size_t size [[maybe_unused]])
+    {
+#ifdef __linux__
+      const auto [first, length] = interior_pages(data, size);
+      if (length != 0)
+        madvise(first, length, MADV_DONTNEED);
+#endif
+    }
+
+
+    /**
+     * Hint the operating system to back the full memory pages within
+     * [data, data + size) with transparent huge pages.
+     */
+    inline void advise_huge_pages(void *data [[maybe_unused]],
+                                  std::size_t size [[maybe_unused]])
+    {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      const auto [first, length] = interior_pages(data, size);
+      if (length != 0)
+        madvise(first, length, MADV_HUGEPAGE);
+#endif
+    }
+
+
+    /**
+     * Zero-initialize the array [data, data + size) in a parallel region
+     * such that every memory page is first-touched by the thread that
+     * later on processes the corresponding rows:
+     *
+     * The functor @p row_range(i, n) has to return the half-open range of
+     * array positions associated with the rows [i, i + n). The vectorized
+     * index range [0, n_internal) is distributed in strides of
+     * simd_length, the non-vectorized index range [n_internal, n_rows)
+     * row by row; both with a static schedule (mirroring the loops in
+     * HyperbolicModule::step()). Array positions that are not associated
+     * with a row are initialized serially.
+     *
+     * Already populated pages are released first. If @p huge_pages is set
+     * to true, then the memory is additionally advised to be backed by
+     * transparent huge pages.
+     */
+    template <typename Number, typename RowRange>
+    void first_touch(Number *data,
+                     const std::size_t size,
+                     const unsigned int n_internal,
+                     const unsigned int n_rows,
+                     const unsigned int simd_length,
+                     const RowRange &row_range,
+                     const bool huge_pages = false)
+    {
+      if (size == 0)
+        return;
+
+      release_pages(data, size * sizeof(Number));
+      if (huge_pages)
+        advise_huge_pages(data, size * sizeof(Number));
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      RYUJIN_OMP_FOR_NOWAIT
+      for (unsigned int i = 0; i < n_internal; i += simd_length) {
+        const auto [begin, end] = row_range(i, simd_length);
+        std::fill(data + begin, data + end, Number(0.));
+      }
+
+      RYUJIN_OMP_FOR_NOWAIT
+      for (unsigned int i = n_internal; i < n_rows; ++i) {
+        const auto [begin, end] = row_range(i, 1);
+        std::fill(data + begin, data + end, Number(0.));
+      }
+
+      RYUJIN_PARALLEL_REGION_END
+
+      const std::size_t covered = n_rows == 0 ? 0 : row_range(0, n_rows).second;
+      std::fill(data + std::min(covered, size), data + size, Number(0.));
+    }
+
+
+    /**
+     * Return the number of memory pages of the array [data, data + size)
+     * that reside on each NUMA node. The last entry of the returned vector
+     * counts pages whose placement could not be determined (for example
+     * because they have not been touched yet, or because the query is not
+     * supported on this platform).
+     */
+    inline std::vector<std::size_t> page_placement(const void *data,
+                                                   std::size_t size)
+    {
+      std::vector<std::size_t> result(1, 0);
+
+#if defined(__linux__) && defined(SYS_move_pages)
+      const auto [first, length] =
+          interior_pages(const_cast<void *>(data), size);
+      const auto page_size = static_cast<std::size_t>(getpagesize());
+      const std::size_t n_pages = length / page_size;
+
+      std::vector<void *> pages(n_pages);
+      for (std::size_t p = 0; p < n_pages; ++p)
+        pages[p] = first + p * page_size;
+      std::vector<int> status(n_pages, -1);
+
+      /* With a null pointer for the target nodes only queries status: */
+      const auto ierr = syscall(SYS_move_pages,
+                                0,
+                                n_pages,
+                                pages.data(),
+                                nullptr,
+                                status.data(),
+                                0);
+
+      if (ierr == 0) {
+        for (const auto node : status) {
+          if (node < 0) {
+            result.back()++;
+            continue;
+          }
+          if (static_cast<std::size_t>(node) + 1 >= result.size())
+            result.insert(result.end() - 1, node + 2 - result.size(), 0);
+          result[node]++;
+        }
+        return result;
+      }
+      result.back() = n_pages;
+#else
+      (void)data;
+      (void)size;
+#endif
+
+      return result;
+    }
+  } // namespace NUMA
+} // namespace ryujin
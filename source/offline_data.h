@@ -9,6 +9,7 @@
 
 #include "convenience_macros.h"
 #include "discretization.h"
+#include "patterns_conversion.h"
 #include "sparse_matrix_simd.h"
 #include "state_vector.h"
 
@@ -22,6 +23,50 @@
 
 #include <deal.II/numerics/data_out.h>
 
+namespace ryujin
+{
+  /**
+   * Controls the renumbering of locally owned degrees of freedom that is
+   * applied prior to grouping indices into SIMD strides.
+   *
+   * @ingroup FiniteElement
+   */
+  enum class DoFRenumberingStrategy {
+    /**
+     * Cuthill McKee renumbering reducing the bandwidth of the
+     * sparsity pattern.
+     */
+    cuthill_mckee,
+
+    /**
+     * Sort degrees of freedom along a Hilbert space filling curve through
+     * their support points.
+     */
+    hilbert,
+
+    /**
+     * Sort degrees of freedom along a Morton (Z-order) space filling
+     * curve through their support points.
+     */
+    morton,
+
+    /**
+     * Enumerate degrees of freedom cell by cell in the order of locally
+     * owned active cells.
+     */
+    cell_wise,
+  };
+} // namespace ryujin
+
+#ifndef DOXYGEN
+DECLARE_ENUM(
+    ryujin::DoFRenumberingStrategy,
+    LIST({ryujin::DoFRenumberingStrategy::cuthill_mckee, "cuthill mckee"},
+         {ryujin::DoFRenumberingStrategy::hilbert, "hilbert"},
+         {ryujin::DoFRenumberingStrategy::morton, "morton"},
+         {ryujin::DoFRenumberingStrategy::cell_wise, "cell wise"}, ));
+#endif
+
 namespace ryujin
 {
   /**
@@ -58,6 +103,29 @@ namespace ryujin
      */
     using ScalarVectorFloat = Vectors::ScalarVector<float>;
 
+    /**
+     * The floating point type used for storing the (geometric) offline
+     * matrices, i.e., the mass matrix, its inverse, the c_ij matrix, and
+     * the incidence matrix. If ryujin is configured with the
+     * MIXED_PRECISION_OFFLINE_MATRICES compile-time option the matrices
+     * are stored in single precision and converted to Number on access.
+     */
+#ifdef MIXED_PRECISION_OFFLINE_MATRICES
+    using MatrixNumber = float;
+#else
+    using MatrixNumber = Number;
+#endif
+
+    /**
+     * The SparseMatrixSIMD type used for storing offline matrices.
+     */
+    template <int n_components = 1>
+    using OfflineMatrix =
+        SparseMatrixSIMD<Number,
+                         n_components,
+                         dealii::VectorizedArray<Number>::size(),
+                         MatrixNumber>;
+
     /**
      * A tuple describing (local) dof index, boundary normal, normal mass,
      * boundary mass, boundary id, and position of the boundary degree of
@@ -325,16 +393,16 @@ namespace ryujin
     SparsityPatternSIMD<dealii::VectorizedArray<Number>::size()>
         sparsity_pattern_simd_;
 
-    SparseMatrixSIMD<Number> mass_matrix_;
-    SparseMatrixSIMD<Number> mass_matrix_inverse_;
+    OfflineMatrix<> mass_matrix_;
+    OfflineMatrix<> mass_matrix_inverse_;
 
     ScalarVector lumped_mass_matrix_;
     ScalarVector lumped_mass_matrix_inverse_;
 
     std::vector<ScalarVectorFloat> level_lumped_mass_matrix_;
 
-    SparseMatrixSIMD<Number, dim> cij_matrix_;
-    SparseMatrixSIMD<Number> incidence_matrix_;
+    OfflineMatrix<dim> cij_matrix_;
+    OfflineMatrix<> incidence_matrix_;
 
     Number measure_of_omega_;
 
@@ -370,6 +438,10 @@ namespace ryujin
     double incidence_relaxation_even_;
     double incidence_relaxation_odd_;
 
+    bool compress_column_indices_;
+
+    DoFRenumberingStrategy dof_renumbering_;
+
     //@}
   };
 
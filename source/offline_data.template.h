@@ -56,6 +56,20 @@ namespace ryujin
                   "Scaling exponent for incidence matrix used for "
                   "discontinuous finite elements with even degree. The default "
                   "value of 0.0 sets the jump penalization to a constant 1.");
+
+    compress_column_indices_ = false;
+    add_parameter("compress column indices",
+                  compress_column_indices_,
+                  "Store column indices and transposed indices of the SIMD "
+                  "sparsity pattern in a compressed 16-bit format. This "
+                  "reduces index traffic in the matrix sweeps.");
+
+    dof_renumbering_ = DoFRenumberingStrategy::cuthill_mckee;
+    add_parameter("dof renumbering",
+                  dof_renumbering_,
+                  "Renumbering of locally owned degrees of freedom applied "
+                  "before grouping indices into SIMD strides. Possible "
+                  "values: cuthill mckee, hilbert, morton, cell wise");
   }
 
 
@@ -207,7 +221,20 @@ namespace ryujin
      * Renumbering:
      */
 
-    DoFRenumbering::Cuthill_McKee(dof_handler);
+    switch (dof_renumbering_) {
+    case DoFRenumberingStrategy::cuthill_mckee:
+      DoFRenumbering::Cuthill_McKee(dof_handler);
+      break;
+    case DoFRenumberingStrategy::hilbert:
+      DoFRenumbering::hilbert(dof_handler, discretization_->mapping());
+      break;
+    case DoFRenumberingStrategy::morton:
+      DoFRenumbering::morton(dof_handler, discretization_->mapping());
+      break;
+    case DoFRenumberingStrategy::cell_wise:
+      DoFRenumbering::cell_wise(dof_handler);
+      break;
+    }
 
     /*
      * Reorder all (individual) export indices at the beginning of the
@@ -314,6 +341,43 @@ namespace ryujin
         create_constraints_and_sparsity_pattern();
         n_locally_internal_ = consistent_stride_range();
       }
+
+      /*
+       * The non-vectorized index range [n_locally_internal_,
+       * n_locally_owned_) now contains all strides that became
+       * inconsistent, as well as the remainder of the initial binning.
+       * Rows of this range that share the same stencil size in the final
+       * sparsity pattern are packed into additional SIMD strides and
+       * appended to the internal range. Export indices are moved to the
+       * front again afterwards.
+       */
+      const auto n_extended_internal = DoFRenumbering::extend_internal_range(
+          dof_handler,
+          sparsity_pattern_,
+          n_locally_internal_,
+          VectorizedArray<Number>::size());
+
+      if (mpi_allreduce_logical_or(n_extended_internal !=
+                                   n_locally_internal_)) {
+        n_locally_internal_ = n_extended_internal;
+        n_export_indices_ = DoFRenumbering::export_indices_first(
+            dof_handler,
+            mpi_communicator_,
+            n_locally_internal_,
+            VectorizedArray<Number>::size());
+        create_constraints_and_sparsity_pattern();
+
+        if (mpi_allreduce_logical_or( //
+                consistent_stride_range() != n_locally_internal_)) {
+          n_locally_internal_ = DoFRenumbering::inconsistent_strides_last(
+              dof_handler,
+              sparsity_pattern_,
+              n_locally_internal_,
+              VectorizedArray<Number>::size());
+          create_constraints_and_sparsity_pattern();
+          n_locally_internal_ = consistent_stride_range();
+        }
+      }
     }
 #endif
 
@@ -396,8 +460,10 @@ namespace ryujin
      * from global deal.II (typical) dof indexing to local indices.
      */
 
-    sparsity_pattern_simd_.reinit(
-        n_locally_internal_, sparsity_pattern_, scalar_partitioner_);
+    sparsity_pattern_simd_.reinit(n_locally_internal_,
+                                  sparsity_pattern_,
+                                  scalar_partitioner_,
+                                  compress_column_indices_);
 
     /*
      * Next we can (re)initialize all local matrices:
@@ -1000,6 +1066,15 @@ namespace ryujin
     }
 
 #ifdef DEBUG
+    /*
+     * Relax the tolerance of the consistency checks below if the offline
+     * matrices are stored in reduced precision:
+     */
+    const Number tolerance =
+        std::is_same_v<MatrixNumber, Number>
+            ? Number(1.e-12)
+            : Number(100. * std::numeric_limits<MatrixNumber>::epsilon());
+
     /*
      * Verify that we have consistent mass:
      */
@@ -1014,6 +1089,8 @@ namespace ryujin
            dealii::ExcMessage(
                "Total mass differs from the measure of the domain."));
 
+    AlignedVector<unsigned int> column_buffer;
+
     /*
      * Verify that the mij_matrix_ object is consistent:
      */
@@ -1029,7 +1106,8 @@ namespace ryujin
 
       /* skip diagonal */
       constexpr auto simd_length = VectorizedArray<Number>::size();
-      const unsigned int *js = sparsity_pattern_simd_.columns(i);
+      const unsigned int *js =
+          sparsity_pattern_simd_.columns(i, column_buffer);
       for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
         const auto j = *(i < n_locally_internal_ ? js + col_idx * simd_length
                                                  : js + col_idx);
@@ -1046,7 +1124,7 @@ namespace ryujin
         sum += m_ij;
 
         const auto m_ji = mass_matrix_.get_transposed_entry(i, col_idx);
-        if (std::abs(m_ij - m_ji) >= 1.e-12) {
+        if (std::abs(m_ij - m_ji) >= tolerance) {
           // The m_ij matrix is not symmetric
           std::stringstream ss;
           ss << "m_ij matrix is not symmetric: " << m_ij << " <-> " << m_ji;
@@ -1054,7 +1132,7 @@ namespace ryujin
         }
       }
 
-      Assert(std::abs(sum) < 1.e-12, dealii::ExcInternalError());
+      Assert(std::abs(sum) < tolerance, dealii::ExcInternalError());
     }
 
     /*
@@ -1071,7 +1149,8 @@ namespace ryujin
 
       /* skip diagonal */
       constexpr auto simd_length = VectorizedArray<Number>::size();
-      const unsigned int *js = sparsity_pattern_simd_.columns(i);
+      const unsigned int *js =
+          sparsity_pattern_simd_.columns(i, column_buffer);
       for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
         const auto j = *(i < n_locally_internal_ ? js + col_idx * simd_length
                                                  : js + col_idx);
@@ -1082,7 +1161,7 @@ namespace ryujin
         sum += c_ij;
 
         const auto c_ji = cij_matrix_.get_transposed_tensor(i, col_idx);
-        if ((c_ij + c_ji).norm() >= 1.e-12) {
+        if ((c_ij + c_ji).norm() >= tolerance) {
           // The c_ij matrix is not symmetric, this can only happen if i
           // and j are both located on the boundary.
 
@@ -1099,7 +1178,7 @@ namespace ryujin
         }
       }
 
-      Assert(sum.norm() < 1.e-12, dealii::ExcInternalError());
+      Assert(sum.norm() < tolerance, dealii::ExcInternalError());
     }
 #endif
   }
@@ -1432,6 +1511,7 @@ namespace ryujin
      */
 
     CouplingBoundaryPairs result;
+    AlignedVector<unsigned int> column_buffer;
 
     for (const auto i : locally_relevant_boundary_indices) {
 
@@ -1445,7 +1525,8 @@ namespace ryujin
       if (row_length == 1)
         continue;
 
-      const unsigned int *js = sparsity_pattern_simd_.columns(i);
+      const unsigned int *js =
+          sparsity_pattern_simd_.columns(i, column_buffer);
       constexpr auto simd_length = VectorizedArray<Number>::size();
       /* skip diagonal: */
       for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
@@ -14,7 +14,14 @@
 #endif
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 /**
  * @name OpenMP parallel for macros
@@ -78,6 +85,16 @@
  */
 #define RYUJIN_OMP_FOR_NOWAIT RYUJIN_PRAGMA(omp for nowait)
 
+/**
+ * Enter a parallel for loop with "nowait" declaration and a loop schedule
+ * that is selected at runtime by calling ryujin::set_loop_schedule() on
+ * all threads prior to entering the loop.
+ *
+ * @ingroup Miscellaneous
+ */
+#define RYUJIN_OMP_FOR_RUNTIME_NOWAIT                                          \
+  RYUJIN_PRAGMA(omp for schedule(runtime) nowait)
+
 /**
  * Declare an explicit Thread synchronization barrier.
  *
@@ -134,15 +151,443 @@
 namespace ryujin
 {
   /**
-   * @todo write documentation
+   * Loop schedules that can be selected at runtime for loops annotated
+   * with RYUJIN_OMP_FOR_RUNTIME_NOWAIT.
+   *
+   * @ingroup Miscellaneous
+   */
+  enum class LoopSchedule {
+    /**
+     * Static schedule: the iteration range is sliced into contiguous
+     * blocks of equal size (or into chunks of the given size that are
+     * distributed in a round-robin fashion).
+     */
+    static_schedule,
+
+    /**
+     * Dynamic schedule: threads grab chunks of the given size from a
+     * shared work queue.
+     */
+    dynamic_schedule,
+
+    /**
+     * Guided schedule: like dynamic, but the chunk size starts large and
+     * decreases down to the given size.
+     */
+    guided_schedule,
+  };
+
+
+  /**
+   * Set the loop schedule used by subsequent RYUJIN_OMP_FOR_RUNTIME_NOWAIT
+   * loops executed by the calling thread. A @p chunk_size of 0 selects
+   * the default chunk size of the schedule.
+   *
+   * @note This function has to be called by all threads of a parallel
+   * region with identical arguments.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline void set_loop_schedule(const LoopSchedule schedule [[maybe_unused]],
+                                const int chunk_size [[maybe_unused]])
+  {
+#ifdef WITH_OPENMP
+    switch (schedule) {
+    case LoopSchedule::static_schedule:
+      omp_set_schedule(omp_sched_static, chunk_size);
+      break;
+    case LoopSchedule::dynamic_schedule:
+      omp_set_schedule(omp_sched_dynamic, chunk_size);
+      break;
+    case LoopSchedule::guided_schedule:
+      omp_set_schedule(omp_sched_guided, chunk_size);
+      break;
+    }
+#endif
+  }
+
+
+  /**
+   * Return the maximal number of threads of a parallel region (1 if
+   * compiled without OpenMP support).
+   *
+   * @ingroup Miscellaneous
+   */
+  inline unsigned int max_thread_count()
+  {
+#ifdef WITH_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+
+  /**
+   * Return the number of the calling thread within the current parallel
+   * region (0 if compiled without OpenMP support).
+   *
+   * @ingroup Miscellaneous
+   */
+  DEAL_II_ALWAYS_INLINE inline unsigned int current_thread_number()
+  {
+#ifdef WITH_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+
+  /**
+   * A small helper class that records per-thread busy and idle times of
+   * worksharing loops. The busy time is the time a thread spends
+   * executing its share of the loop, the idle time is the time it
+   * subsequently waits in the synchronization barrier.
+   *
+   * Intended use:
+   * ```
+   * RYUJIN_PARALLEL_REGION_BEGIN
+   * statistics.loop_begin();
+   *
+   * RYUJIN_OMP_FOR_NOWAIT
+   * for (unsigned int i = 0; i < size; ++i) {
+   *   // ...
+   * }
+   *
+   * statistics.loop_end();
+   * RYUJIN_OMP_BARRIER
+   * statistics.barrier_end();
+   * RYUJIN_PARALLEL_REGION_END
+   * ```
+   *
+   * All functions are no-ops unless the object is enabled.
+   *
+   * @ingroup Miscellaneous
+   */
+  class ThreadLoadStatistics
+  {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * Enable (or disable) recording and reset all accumulated times.
+     */
+    void reinit(const bool enable)
+    {
+      enabled_ = enable;
+      entries_.resize(enable ? max_thread_count() : 0);
+      for (auto &entry : entries_)
+        entry = Entry();
+    }
+
+    /**
+     * Return true if recording is enabled.
+     */
+    bool enabled() const
+    {
+      return enabled_;
+    }
+
+    /**
+     * Record the start of the calling thread's share of a loop.
+     */
+    DEAL_II_ALWAYS_INLINE inline void loop_begin()
+    {
+      if (RYUJIN_LIKELY(!enabled_))
+        return;
+      entry().start = clock::now();
+    }
+
+    /**
+     * Record the end of the calling thread's share of a loop and
+     * accumulate the busy time.
+     */
+    DEAL_II_ALWAYS_INLINE inline void loop_end()
+    {
+      if (RYUJIN_LIKELY(!enabled_))
+        return;
+      auto &current = entry();
+      current.stop = clock::now();
+      current.busy += current.stop - current.start;
+    }
+
+    /**
+     * Record the end of the synchronization barrier following a loop and
+     * accumulate the idle time.
+     */
+    DEAL_II_ALWAYS_INLINE inline void barrier_end()
+    {
+      if (RYUJIN_LIKELY(!enabled_))
+        return;
+      auto &current = entry();
+      current.idle += clock::now() - current.stop;
+    }
+
+    /**
+     * Return the accumulated busy time (in seconds) of all threads.
+     */
+    std::vector<double> busy_times() const
+    {
+      std::vector<double> result;
+      for (const auto &entry : entries_)
+        result.push_back(std::chrono::duration<double>(entry.busy).count());
+      return result;
+    }
+
+    /**
+     * Return the accumulated idle time (in seconds) of all threads.
+     */
+    std::vector<double> idle_times() const
+    {
+      std::vector<double> result;
+      for (const auto &entry : entries_)
+        result.push_back(std::chrono::duration<double>(entry.idle).count());
+      return result;
+    }
+
+  private:
+    /*
+     * Pad every entry to a full cache line to avoid false sharing.
+     */
+    struct alignas(64) Entry {
+      clock::time_point start;
+      clock::time_point stop;
+      clock::duration busy = clock::duration::zero();
+      clock::duration idle = clock::duration::zero();
+    };
+
+    DEAL_II_ALWAYS_INLINE inline Entry &entry()
+    {
+      return entries_[current_thread_number()];
+    }
+
+    bool enabled_ = false;
+    std::vector<Entry> entries_;
+  };
+
+
+  /**
+   * A small helper class that accumulates how much of the time spent in
+   * SynchronizationDispatch payloads (i.e., MPI ghost exchanges) was
+   * hidden behind computation.
+   *
+   * For every payload the communication time is the time between
+   * launching the payload and its completion, the exposed time is the
+   * time the calling thread had to wait for the payload after finishing
+   * its computation. Payloads that are executed synchronously are fully
+   * exposed.
+   *
+   * @ingroup Miscellaneous
+   */
+  class CommunicationStatistics
+  {
+  public:
+    /**
+     * Reset all accumulated times.
+     */
+    void reset()
+    {
+      communication_time_ = 0.;
+      exposed_time_ = 0.;
+      n_payloads_ = 0;
+    }
+
+    /**
+     * Record a payload with given @p communication time and @p exposed
+     * time (in seconds).
+     */
+    void record(const double communication, const double exposed)
+    {
+      communication_time_ += communication;
+      exposed_time_ += exposed;
+      ++n_payloads_;
+    }
+
+    /**
+     * Return the accumulated communication time (in seconds).
+     */
+    double communication_time() const
+    {
+      return communication_time_;
+    }
+
+    /**
+     * Return the accumulated exposed time (in seconds).
+     */
+    double exposed_time() const
+    {
+      return exposed_time_;
+    }
+
+    /**
+     * Return the number of recorded payloads.
+     */
+    unsigned int n_payloads() const
+    {
+      return n_payloads_;
+    }
+
+  private:
+    double communication_time_ = 0.;
+    double exposed_time_ = 0.;
+    unsigned int n_payloads_ = 0;
+  };
+
+
+  /**
+   * A persistent communication thread that executes queued payloads (MPI
+   * ghost exchanges) of SynchronizationDispatch objects.
+   *
+   * The thread is created on first use and reused for the lifetime of the
+   * program. It is deliberately not pinned: every CPU of the affinity mask
+   * of the process typically runs an OpenMP worker thread, so we leave
+   * placement to the operating system scheduler. While idle the thread
+   * polls its queue for a short while (yielding the CPU) before going to
+   * sleep on a condition variable, so that payloads issued in quick
+   * succession start with low latency.
+   *
+   * The payloads are responsible for progressing their MPI requests:
+   * PersistentRequests::wait() polls with MPI_Testall() and yields or
+   * backs off in between, so that the communication thread does not
+   * starve a worker thread sharing the same CPU.
+   *
+   * @note MPI calls are only issued from within payloads. Since at most
+   * one payload is in flight at a time and the worker threads do not
+   * communicate while a payload is running, the MPI library only needs to
+   * provide MPI_THREAD_SERIALIZED.
+   *
+   * @ingroup Miscellaneous
+   */
+  class CommunicationThread
+  {
+  public:
+    /**
+     * Return a reference to the (lazily created) communication thread.
+     */
+    static CommunicationThread &instance()
+    {
+      static CommunicationThread communication_thread;
+      return communication_thread;
+    }
+
+    /**
+     * Queue @p payload for execution. The returned future becomes ready
+     * once the payload has been executed.
+     */
+    std::future<void> submit(const std::function<void()> &payload)
+    {
+      std::packaged_task<void()> task(payload);
+      auto future = task.get_future();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(task));
+        n_queued_.store(queue_.size(), std::memory_order_release);
+      }
+      condition_.notify_one();
+      return future;
+    }
+
+    CommunicationThread(const CommunicationThread &) = delete;
+    CommunicationThread &operator=(const CommunicationThread &) = delete;
+
+  private:
+    CommunicationThread()
+        : n_queued_(0)
+        , terminate_(false)
+        , thread_([this]() { run(); })
+    {
+    }
+
+    ~CommunicationThread()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        terminate_ = true;
+      }
+      condition_.notify_one();
+      thread_.join();
+    }
+
+    void run()
+    {
+      using clock = std::chrono::steady_clock;
+      constexpr auto spin_duration = std::chrono::microseconds(200);
+
+      while (true) {
+        /* Poll for a short while before going to sleep: */
+        const auto spin_start = clock::now();
+        while (n_queued_.load(std::memory_order_acquire) == 0 &&
+               clock::now() - spin_start < spin_duration)
+          std::this_thread::yield();
+
+        std::packaged_task<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          condition_.wait(lock,
+                          [this]() { return terminate_ || !queue_.empty(); });
+          if (queue_.empty())
+            return;
+          task = std::move(queue_.front());
+          queue_.pop_front();
+          n_queued_.store(queue_.size(), std::memory_order_release);
+        }
+
+        task();
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::packaged_task<void()>> queue_;
+    std::atomic<std::size_t> n_queued_;
+    bool terminate_;
+    std::thread thread_;
+  };
+
+
+  /**
+   * A helper class that starts a communication payload (typically an MPI
+   * ghost exchange) as soon as all threads of a parallel region have
+   * finished computing the values that have to be exported, and waits for
+   * its completion when the object goes out of scope.
+   *
+   * Intended use:
+   * ```
+   * SynchronizationDispatch synchronization_dispatch([&]() {
+   *   vector.update_ghost_values_start(channel++);
+   *   vector.update_ghost_values_finish();
+   * });
+   *
+   * RYUJIN_PARALLEL_REGION_BEGIN
+   * bool thread_ready = false;
+   *
+   * RYUJIN_OMP_FOR
+   * for (unsigned int i = 0; i < size; ++i) {
+   *   synchronization_dispatch.check(thread_ready, i >= n_export_indices);
+   *   // ...
+   * }
+   * RYUJIN_PARALLEL_REGION_END
+   * ```
+   *
+   * If ryujin is configured with ASYNC_MPI_EXCHANGE the payload is
+   * queued on the persistent CommunicationThread once all threads have
+   * reported to be ready. Otherwise, the payload is executed
+   * synchronously in the destructor. If a CommunicationStatistics object
+   * is supplied, the communication and exposed wait time of the payload
+   * are recorded.
    *
    * @ingroup Miscellaneous
    */
   class SynchronizationDispatch
   {
   public:
-    SynchronizationDispatch(const std::function<void()> &async_payload)
+    using clock = std::chrono::steady_clock;
+
+    SynchronizationDispatch(const std::function<void()> &async_payload,
+                            CommunicationStatistics *statistics = nullptr)
         : async_payload_(async_payload)
+        , statistics_(statistics)
         , n_threads_ready_(0)
     {
     }
@@ -151,10 +596,21 @@ namespace ryujin
     {
       /* Executes in serial, non thread-parallel context: */
 
+      const auto wait_start = clock::now();
+
       if (payload_status_.valid()) {
         payload_status_.wait();
       } else {
+        launched_ = wait_start;
         async_payload_();
+        completed_ = clock::now();
+      }
+
+      if (statistics_ != nullptr) {
+        const auto wait_end = clock::now();
+        statistics_->record(
+            std::chrono::duration<double>(completed_ - launched_).count(),
+            std::chrono::duration<double>(wait_end - wait_start).count());
       }
     }
 
@@ -168,7 +624,13 @@ namespace ryujin
 #ifdef WITH_OPENMP
         if (++n_threads_ready_ == omp_get_num_threads())
 #endif
-          payload_status_ = std::async(std::launch::async, async_payload_);
+        {
+          launched_ = clock::now();
+          payload_status_ = CommunicationThread::instance().submit([this]() {
+            async_payload_();
+            completed_ = clock::now();
+          });
+        }
       }
     }
 #else
@@ -177,8 +639,11 @@ namespace ryujin
 
   private:
     const std::function<void()> async_payload_;
+    CommunicationStatistics *const statistics_;
     std::future<void> payload_status_;
     std::atomic_int n_threads_ready_;
+    clock::time_point launched_;
+    clock::time_point completed_;
   };
 } // namespace ryujin
 
@@ -0,0 +1,675 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * Precision of the values transferred in a ghost exchange.
+   *
+   * Reduced precision payloads are rounded down. The sending rank
+   * overwrites its own copy of the transferred values with the rounded
+   * values, so that all ranks work on bitwise identical values. This is
+   * necessary for quantities that enter the update symmetrically (such
+   * as limiter coefficients l_ij = l_ji, or indicator values alpha_i
+   * averaged over an edge). Rounding down keeps limiter coefficients on
+   * the conservative side.
+   *
+   * @ingroup Miscellaneous
+   */
+  enum class PayloadPrecision {
+    /**
+     * Transfer values in full precision.
+     */
+    full,
+
+    /**
+     * Transfer values rounded to single precision.
+     */
+    single,
+
+    /**
+     * Transfer values in the interval [0, 1] as 16-bit fixed point
+     * numbers. Values outside of [0, 1] are clamped.
+     */
+    fixed_point_16,
+  };
+
+
+  /**
+   * Encoding and decoding of ghost exchange payloads with a given
+   * PayloadPrecision.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <typename Number>
+  struct PayloadCodec {
+    /**
+     * Return the number of bytes of an encoded value.
+     */
+    static std::size_t size(const PayloadPrecision precision)
+    {
+      switch (precision) {
+      case PayloadPrecision::single:
+        return sizeof(float);
+      case PayloadPrecision::fixed_point_16:
+        return sizeof(std::uint16_t);
+      default:
+        return sizeof(Number);
+      }
+    }
+
+    /**
+     * Store @p value rounded down to the given @p precision at position
+     * @p k of @p buffer and return the rounded value.
+     */
+    static Number encode(const Number value,
+                         const PayloadPrecision precision,
+                         void *buffer,
+                         const std::size_t k)
+    {
+      switch (precision) {
+      case PayloadPrecision::single: {
+        auto rounded = static_cast<float>(value);
+        if (rounded > value)
+          rounded = std::nextafter(rounded, -1.f);
+        static_cast<float *>(buffer)[k] = rounded;
+        return Number(rounded);
+      }
+      case PayloadPrecision::fixed_point_16: {
+        const Number clamped = std::clamp(value, Number(0.), Number(1.));
+        auto rounded =
+            static_cast<std::uint16_t>(std::floor(clamped * Number(65535.)));
+        /*
+         * Correct for round-off in the scaling so that encoding is
+         * idempotent and never rounds up:
+         */
+        if (rounded < 65535 && Number(rounded + 1) / Number(65535.) <= clamped)
+          ++rounded;
+        else if (rounded > 0 && Number(rounded) / Number(65535.) > clamped)
+          --rounded;
+        static_cast<std::uint16_t *>(buffer)[k] = rounded;
+        return Number(rounded) / Number(65535.);
+      }
+      default:
+        static_cast<Number *>(buffer)[k] = value;
+        return value;
+      }
+    }
+
+    /**
+     * Return the value stored at position @p k of @p buffer.
+     */
+    static Number decode(const PayloadPrecision precision,
+                         const void *buffer,
+                         const std::size_t k)
+    {
+      switch (precision) {
+      case PayloadPrecision::single:
+        return Number(static_cast<const float *>(buffer)[k]);
+      case PayloadPrecision::fixed_point_16:
+        return Number(static_cast<const std::uint16_t *>(buffer)[k]) /
+               Number(65535.);
+      default:
+        return static_cast<const Number *>(buffer)[k];
+      }
+    }
+  };
+
+
+  /**
+   * A container for persistent MPI point-to-point requests.
+   *
+   * A ghost exchange with a fixed communication pattern (fixed send and
+   * receive targets, fixed buffers and message sizes) can be set up once
+   * with MPI_Recv_init() and MPI_Send_init() and then be started
+   * repeatedly with MPI_Startall(). This avoids creating (and matching) a
+   * new request for every message of every exchange.
+   *
+   * Request sets are stored under a key consisting of the addresses of
+   * all receive buffers, the communication channel (which determines the
+   * MPI tag), and the payload precision. Every request set owns a send
+   * buffer that its persistent send requests are bound to. All requests
+   * are freed when the container is cleared or destroyed. Copies of a
+   * container start out empty, moving a container transfers all request
+   * sets.
+   *
+   * @note The container has to be cleared whenever the communication
+   * pattern or the receive buffers change.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <typename Number>
+  class PersistentRequests
+  {
+  public:
+    /**
+     * A contiguous range of @p n_elements values that corresponds to the
+     * buffer entries [offset, offset + n_elements).
+     */
+    struct Copy {
+      Number *values;
+      std::size_t offset;
+      std::size_t n_elements;
+    };
+
+    /**
+     * A set of persistent requests: The first @p n_receives requests are
+     * receive requests, followed by the send requests bound to
+     * @p send_buffer. Receive requests are either bound directly to the
+     * final destination, or to the staging @p receive_buffer. The
+     * optional copy plans @p pack and @p unpack describe how to populate
+     * the send buffer and how to distribute the staging buffer. Buffers
+     * hold encoded values of the given @p precision.
+     */
+    struct RequestSet {
+      std::vector<MPI_Request> requests;
+      unsigned int n_receives = 0;
+      dealii::AlignedVector<Number> send_buffer;
+      dealii::AlignedVector<Number> receive_buffer;
+      std::vector<Copy> pack;
+      std::vector<Copy> unpack;
+      PayloadPrecision precision = PayloadPrecision::full;
+    };
+
+    using Key =
+        std::tuple<std::vector<const void *>, unsigned int, PayloadPrecision>;
+
+    PersistentRequests() = default;
+
+    PersistentRequests(const PersistentRequests &)
+    {
+      /* Persistent requests are bound to the buffers of the original. */
+    }
+
+    PersistentRequests(PersistentRequests &&other) noexcept
+        : request_sets_(std::move(other.request_sets_))
+    {
+      other.request_sets_.clear();
+    }
+
+    PersistentRequests &operator=(const PersistentRequests &other)
+    {
+      if (this != &other)
+        clear();
+      return *this;
+    }
+
+    PersistentRequests &operator=(PersistentRequests &&other) noexcept
+    {
+      if (this != &other) {
+        clear();
+        request_sets_ = std::move(other.request_sets_);
+        other.request_sets_.clear();
+      }
+      return *this;
+    }
+
+    ~PersistentRequests()
+    {
+      clear();
+    }
+
+    /**
+     * Return a pointer to the request set stored for @p key, or a null
+     * pointer if no such set exists.
+     */
+    RequestSet *find(const Key &key)
+    {
+      const auto it = request_sets_.find(key);
+      return it == request_sets_.end() ? nullptr : &it->second;
+    }
+
+    /**
+     * Create a new (empty) request set for @p key and return a reference
+     * to it.
+     */
+    RequestSet &create(const Key &key)
+    {
+      Assert(find(key) == nullptr, dealii::ExcInternalError());
+      return request_sets_[key];
+    }
+
+    /**
+     * Start all receive requests of @p set.
+     */
+    static void start_receives(RequestSet &set)
+    {
+#ifdef DEAL_II_WITH_MPI
+      if (set.n_receives == 0)
+        return;
+      const int ierr = MPI_Startall(set.n_receives, set.requests.data());
+      AssertThrowMPI(ierr);
+#endif
+    }
+
+    /**
+     * Start all send requests of @p set. The send buffer has to be
+     * populated prior to calling this function.
+     */
+    static void start_sends(RequestSet &set)
+    {
+#ifdef DEAL_II_WITH_MPI
+      const unsigned int n_sends = set.requests.size() - set.n_receives;
+      if (n_sends == 0)
+        return;
+      const int ierr =
+          MPI_Startall(n_sends, set.requests.data() + set.n_receives);
+      AssertThrowMPI(ierr);
+#endif
+    }
+
+    /**
+     * Wait for all (started) requests of @p set to complete. The requests
+     * remain allocated and can be started again.
+     *
+     * We poll with MPI_Testall() instead of blocking in MPI_Waitall(): the
+     * wait is typically executed on the CommunicationThread that might
+     * share a CPU with a worker thread. We yield the CPU for the first
+     * couple of polls and then back off exponentially (up to 64
+     * microseconds between polls) so that a long wait does not keep a
+     * CPU busy.
+     */
+    static void wait(RequestSet &set)
+    {
+#ifdef DEAL_II_WITH_MPI
+      constexpr unsigned int n_spin_polls = 64;
+      constexpr unsigned int max_backoff_shift = 6;
+
+      int flag = 0;
+      for (unsigned int n_polls = 0;; ++n_polls) {
+        const int ierr = MPI_Testall(set.requests.size(),
+                                     set.requests.data(),
+                                     &flag,
+                                     MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+        if (flag != 0)
+          return;
+
+        if (n_polls < n_spin_polls) {
+          std::this_thread::yield();
+        } else {
+          const auto shift =
+              std::min(n_polls - n_spin_polls, max_backoff_shift);
+          std::this_thread::sleep_for(std::chrono::microseconds(1u << shift));
+        }
+      }
+#endif
+    }
+
+    /**
+     * Free all persistent requests.
+     */
+    void clear()
+    {
+#ifdef DEAL_II_WITH_MPI
+      /* Static objects might get destroyed after MPI_Finalize(): */
+      int finalized = 0;
+      MPI_Finalized(&finalized);
+      if (finalized == 0)
+        for (auto &[key, set] : request_sets_)
+          for (auto &request : set.requests)
+            if (request != MPI_REQUEST_NULL)
+              MPI_Request_free(&request);
+#endif
+      request_sets_.clear();
+    }
+
+  private:
+    std::map<Key, RequestSet> request_sets_;
+  };
+
+
+  /**
+   * Fused ghost value exchange for one or more
+   * dealii::LinearAlgebra::distributed::Vector objects (and the derived
+   * MultiComponentVector) with persistent MPI requests.
+   *
+   * start() and finish() perform the same communication as calling
+   * update_ghost_values_start() and update_ghost_values_finish() on every
+   * vector: the values of all import indices are sent to the owning ranks
+   * of the corresponding ghost indices with the MPI tag
+   * `partitioner_export_start + communication_channel`. The payloads of
+   * all vectors that are destined for the same MPI rank are aggregated
+   * into a single message, so that every synchronization point sends
+   * exactly one message per neighboring rank regardless of the number of
+   * vectors involved. The persistent requests for a given list of vectors
+   * (identified by the addresses of their data arrays) and channel are set
+   * up on first use and reused afterwards.
+   *
+   * Intended use within a SynchronizationDispatch:
+   * ```
+   * SynchronizationDispatch synchronization_dispatch([&]() {
+   *   ghost_exchange.start({&r, &bounds}, channel++);
+   *   ghost_exchange.finish();
+   * });
+   * ```
+   *
+   * @note All vectors have to be distributed over the same communicator
+   * and have to be passed in the same order on all MPI ranks. Just like
+   * update_ghost_values_finish(), finish() sets the ghost state
+   * (has_ghost_elements()) of all vectors. clear() has to be called
+   * whenever the partitioner of any of the participating vectors
+   * changes.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <typename Number>
+  class PersistentGhostExchange
+  {
+  public:
+    using Vector = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+    /**
+     * Start the fused ghost value exchange for all @p vectors. With a
+     * reduced payload @p precision the (locally owned) import values are
+     * overwritten by the rounded values that are sent.
+     */
+    void start(const std::initializer_list<const Vector *> vectors,
+               const unsigned int communication_channel = 0,
+               const PayloadPrecision precision = PayloadPrecision::full);
+
+    /**
+     * Start the ghost value exchange for a single @p vector.
+     */
+    void start(const Vector &vector,
+               const unsigned int communication_channel = 0,
+               const PayloadPrecision precision = PayloadPrecision::full)
+    {
+      start({&vector}, communication_channel, precision);
+    }
+
+    /**
+     * Finish the ghost value exchange that was started last and mark all
+     * participating vectors as ghosted.
+     */
+    void finish();
+
+    /**
+     * Start and finish the ghost value exchange for @p vector.
+     */
+    void update_ghost_values(const Vector &vector,
+                             const unsigned int communication_channel = 0)
+    {
+      start(vector, communication_channel);
+      finish();
+    }
+
+    /**
+     * Free all persistent requests.
+     */
+    void clear()
+    {
+      active_set_ = nullptr;
+      active_vectors_.clear();
+      requests_.clear();
+    }
+
+  private:
+    using RequestSet = typename PersistentRequests<Number>::RequestSet;
+
+    /**
+     * Set up the persistent requests and copy plans for @p key.
+     */
+    RequestSet &create(const typename PersistentRequests<Number>::Key &key,
+                       const std::initializer_list<const Vector *> vectors);
+
+    PersistentRequests<Number> requests_;
+    RequestSet *active_set_ = nullptr;
+    std::vector<const Vector *> active_vectors_;
+  };
+
+
+  template <typename Number>
+  void PersistentGhostExchange<Number>::start(
+      const std::initializer_list<const Vector *> vectors,
+      const unsigned int communication_channel,
+      const PayloadPrecision precision)
+  {
+#ifdef DEAL_II_WITH_MPI
+    Assert(active_set_ == nullptr,
+           dealii::ExcMessage("A ghost exchange is already in flight"));
+
+    typename PersistentRequests<Number>::Key key{
+        {}, communication_channel, precision};
+    auto &buffers = std::get<0>(key);
+    buffers.reserve(vectors.size());
+    for (const auto *vector : vectors)
+      buffers.push_back(vector->begin());
+
+    auto *set = requests_.find(key);
+    if (set == nullptr)
+      set = &create(key, vectors);
+
+    PersistentRequests<Number>::start_receives(*set);
+
+    auto *send_buffer = set->send_buffer.data();
+    for (const auto &[values, offset, n_elements] : set->pack) {
+      if (precision == PayloadPrecision::full) {
+        std::copy(values, values + n_elements, send_buffer + offset);
+      } else {
+        for (std::size_t k = 0; k < n_elements; ++k)
+          values[k] = PayloadCodec<Number>::encode(
+              values[k], precision, send_buffer, offset + k);
+      }
+    }
+
+    PersistentRequests<Number>::start_sends(*set);
+
+    active_set_ = set;
+    active_vectors_.assign(vectors.begin(), vectors.end());
+#else
+    active_vectors_.assign(vectors.begin(), vectors.end());
+    (void)communication_channel;
+    (void)precision;
+#endif
+  }
+
+
+  template <typename Number>
+  void PersistentGhostExchange<Number>::finish()
+  {
+#ifdef DEAL_II_WITH_MPI
+    Assert(active_set_ != nullptr,
+           dealii::ExcMessage("No ghost exchange is in flight"));
+
+    PersistentRequests<Number>::wait(*active_set_);
+
+    const auto precision = active_set_->precision;
+    const auto *receive_buffer = active_set_->receive_buffer.data();
+    for (const auto &[values, offset, n_elements] : active_set_->unpack) {
+      if (precision == PayloadPrecision::full) {
+        std::copy(receive_buffer + offset,
+                  receive_buffer + offset + n_elements,
+                  values);
+      } else {
+        for (std::size_t k = 0; k < n_elements; ++k)
+          values[k] = PayloadCodec<Number>::decode(
+              precision, receive_buffer, offset + k);
+      }
+    }
+
+    active_set_ = nullptr;
+#endif
+
+    for (const auto *vector : active_vectors_)
+      vector->set_ghost_state(true);
+    active_vectors_.clear();
+  }
+
+
+  template <typename Number>
+  auto PersistentGhostExchange<Number>::create(
+      const typename PersistentRequests<Number>::Key &key,
+      const std::initializer_list<const Vector *> vectors) -> RequestSet &
+  {
+    Assert(vectors.size() != 0, dealii::ExcInternalError());
+
+    const auto communication_channel = std::get<1>(key);
+    const auto precision = std::get<2>(key);
+    const auto n_bytes = PayloadCodec<Number>::size(precision);
+    AssertIndexRange(communication_channel, 200);
+    const int mpi_tag =
+        dealii::Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+    Assert(mpi_tag <=
+               dealii::Utilities::MPI::internal::Tags::partitioner_export_end,
+           dealii::ExcInternalError());
+
+    const auto mpi_communicator =
+        (*vectors.begin())->get_partitioner()->get_mpi_communicator();
+
+    /*
+     * Collect the (contiguous) chunks of ghost values to receive from and
+     * the chunks of import values to send to every neighboring rank. The
+     * chunks of a given rank are ordered by vector.
+     */
+
+    std::map<unsigned int, std::vector<std::pair<Number *, unsigned int>>>
+        receives;
+    std::map<unsigned int, std::vector<std::pair<Number *, unsigned int>>>
+        sends;
+
+    for (const auto *vector : vectors) {
+      const auto &partitioner = *vector->get_partitioner();
+
+      /*
+       * The ghost values are written by the exchange, which (just like for
+       * Vector::update_ghost_values()) is not considered to be a
+       * modification of the vector:
+       */
+      auto *const values = const_cast<Number *>(vector->begin());
+
+      /* Ghost values are stored contiguously ordered by owning rank: */
+      Number *ghost_values = values + partitioner.locally_owned_size();
+      for (const auto &[rank, n_indices] : partitioner.ghost_targets()) {
+        receives[rank].emplace_back(ghost_values, n_indices);
+        ghost_values += n_indices;
+      }
+      Assert(ghost_values == values + partitioner.locally_owned_size() +
+                                 partitioner.n_ghost_indices(),
+             dealii::ExcMessage("The persistent ghost exchange does not "
+                                "support ghost index subsets"));
+
+      /* Split the import index ranges by target rank: */
+      auto range = partitioner.import_indices().begin();
+      unsigned int offset = 0;
+      for (const auto &[rank, n_indices] : partitioner.import_targets()) {
+        for (unsigned int remaining = n_indices; remaining > 0;) {
+          const auto [first, last] = *range;
+          const unsigned int n = std::min(remaining, last - first - offset);
+          sends[rank].emplace_back(values + first + offset, n);
+          remaining -= n;
+          offset += n;
+          if (first + offset == last) {
+            ++range;
+            offset = 0;
+          }
+        }
+      }
+    }
+
+    auto &set = requests_.create(key);
+    set.n_receives = receives.size();
+    set.requests.resize(receives.size() + sends.size());
+    set.precision = precision;
+
+    /*
+     * Set up persistent receive requests. A full precision message that
+     * consists of a single chunk is received directly into the ghost
+     * range, all other messages are staged in the receive buffer:
+     */
+
+    const auto staged = [&](const auto &chunks) {
+      return precision != PayloadPrecision::full || chunks.size() > 1;
+    };
+
+    std::size_t n_staged = 0;
+    for (const auto &[rank, chunks] : receives)
+      if (staged(chunks))
+        for (const auto &[ghost_values, n] : chunks)
+          n_staged += n;
+    set.receive_buffer.resize_fast(n_staged);
+
+    unsigned int p = 0;
+    std::size_t offset = 0;
+    for (const auto &[rank, chunks] : receives) {
+      void *message = chunks.front().first;
+      std::size_t size = chunks.front().second;
+
+      if (staged(chunks)) {
+        message = reinterpret_cast<char *>(set.receive_buffer.data()) +
+                  offset * n_bytes;
+        size = 0;
+        for (const auto &[ghost_values, n] : chunks) {
+          set.unpack.push_back({ghost_values, offset + size, n});
+          size += n;
+        }
+        offset += size;
+      }
+
+      const int ierr = MPI_Recv_init(message,
+                                     size * n_bytes,
+                                     MPI_BYTE,
+                                     rank,
+                                     mpi_tag,
+                                     mpi_communicator,
+                                     &set.requests[p++]);
+      AssertThrowMPI(ierr);
+    }
+
+    /*
+     * Set up persistent send requests and the plan for packing all import
+     * values into one message per rank:
+     */
+
+    std::size_t n_send = 0;
+    for (const auto &[rank, chunks] : sends)
+      for (const auto &[import_values, n] : chunks)
+        n_send += n;
+    set.send_buffer.resize_fast(n_send);
+
+    offset = 0;
+    for (const auto &[rank, chunks] : sends) {
+      void *message =
+          reinterpret_cast<char *>(set.send_buffer.data()) + offset * n_bytes;
+      std::size_t size = 0;
+      for (const auto &[import_values, n] : chunks) {
+        set.pack.push_back({import_values, offset + size, n});
+        size += n;
+      }
+      offset += size;
+
+      const int ierr = MPI_Send_init(message,
+                                     size * n_bytes,
+                                     MPI_BYTE,
+                                     rank,
+                                     mpi_tag,
+                                     mpi_communicator,
+                                     &set.requests[p++]);
+      AssertThrowMPI(ierr);
+    }
+
+    return set;
+  }
+} // namespace ryujin
@@ -148,6 +148,7 @@ namespace ryujin
 
         std::vector<grad_type<T>> local_schlieren_values(n_schlieren);
         std::vector<curl_type<T>> local_vorticity_values(n_vorticities);
+        dealii::AlignedVector<unsigned int> column_buffer;
 
         RYUJIN_OMP_FOR
         for (unsigned int i = left; i < right; i += stride_size) {
@@ -162,7 +163,7 @@ namespace ryujin
           if (row_length == 1)
             continue;
 
-          const unsigned int *js = sparsity_simd.columns(i);
+          const unsigned int *js = sparsity_simd.columns(i, column_buffer);
           for (unsigned int col_idx = 0; col_idx < row_length;
                ++col_idx, js += stride_size) {
 
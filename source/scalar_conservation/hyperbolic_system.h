@@ -273,6 +273,14 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 1;
 
+      /**
+       * The first precomputation cycle only depends on the state of the
+       * current row. HyperbolicModule can thus fuse it into the final
+       * write-back loop of the preceding step() by calling
+       * row_precomputation().
+       */
+      static constexpr bool have_row_local_precomputation = true;
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -285,6 +293,12 @@ namespace ryujin
                                unsigned int left,
                                unsigned int right) const;
 
+      /**
+       * Return the values of the first precomputation cycle for the state
+       * @p U_i.
+       */
+      precomputed_type row_precomputation(const state_type &U_i) const;
+
       //@}
       /**
        * @name Computing derived physical quantities
@@ -594,6 +608,27 @@ namespace ryujin
     }
 
 
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::row_precomputation(
+        const state_type &U_i) const -> precomputed_type
+    {
+      const auto u_i = state(U_i);
+
+      const auto f_i = flux_function(u_i);
+      const auto df_i = flux_gradient_function(u_i);
+
+      precomputed_type prec_i;
+
+      for (unsigned int k = 0; k < n_precomputed_values / 2; ++k) {
+        prec_i[k] = f_i[k];
+        prec_i[dim + k] = df_i[k];
+      }
+
+      return prec_i;
+    }
+
+
     template <int dim, typename Number>
     template <typename DISPATCH, typename SPARSITY>
     DEAL_II_ALWAYS_INLINE inline void
@@ -625,19 +660,7 @@ namespace ryujin
         dispatch_check(i);
 
         const auto U_i = U.template get_tensor<Number>(i);
-        const auto u_i = state(U_i);
-
-        const auto f_i = flux_function(u_i);
-        const auto df_i = flux_gradient_function(u_i);
-
-        precomputed_type prec_i;
-
-        for (unsigned int k = 0; k < n_precomputed_values / 2; ++k) {
-          prec_i[k] = f_i[k];
-          prec_i[dim + k] = df_i[k];
-        }
-
-        precomputed.template write_tensor<Number>(prec_i, i);
+        precomputed.template write_tensor<Number>(row_precomputation(U_i), i);
       }
     }
 
@@ -300,6 +300,14 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 1;
 
+      /**
+       * The first precomputation cycle only depends on the state of the
+       * current row. HyperbolicModule can thus fuse it into the final
+       * write-back loop of the preceding step() by calling
+       * row_precomputation().
+       */
+      static constexpr bool have_row_local_precomputation = true;
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -312,6 +320,12 @@ namespace ryujin
                                unsigned int left,
                                unsigned int right) const;
 
+      /**
+       * Return the values of the first precomputation cycle for the state
+       * @p U_i.
+       */
+      precomputed_type row_precomputation(const state_type &U_i) const;
+
       //@}
       /**
        * @name Computing derived physical quantities
@@ -673,6 +687,20 @@ namespace ryujin
     }
 
 
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::row_precomputation(
+        const state_type &U_i) const -> precomputed_type
+    {
+      const auto eta_m = mathematical_entropy(U_i);
+
+      const auto h_sharp = water_depth_sharp(U_i);
+      const auto h_star = ryujin::pow(h_sharp, ScalarNumber(4. / 3.));
+
+      return {eta_m, h_star};
+    }
+
+
     template <int dim, typename Number>
     template <typename DISPATCH, typename SPARSITY>
     DEAL_II_ALWAYS_INLINE inline void
@@ -704,14 +732,7 @@ namespace ryujin
         dispatch_check(i);
 
         const auto U_i = U.template get_tensor<Number>(i);
-
-        const auto eta_m = mathematical_entropy(U_i);
-
-        const auto h_sharp = water_depth_sharp(U_i);
-        const auto h_star = ryujin::pow(h_sharp, ScalarNumber(4. / 3.));
-
-        const precomputed_type prec_i{eta_m, h_star};
-        precomputed.template write_tensor<Number>(prec_i, i);
+        precomputed.template write_tensor<Number>(row_precomputation(U_i), i);
       }
     }
 
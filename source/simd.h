@@ -486,6 +486,142 @@ namespace ryujin
     result = serial;
   }
 
+
+  /**
+   * Load VectorizedArray::size() consecutive values of type
+   * @p StorageNumber starting at @p ptr and convert them to the
+   * VectorizedArray @p result. Single precision values are converted to
+   * double precision with a single vector load and conversion instruction
+   * where available.
+   *
+   * @ingroup SIMD
+   */
+  template <typename Number, std::size_t width, typename StorageNumber>
+  DEAL_II_ALWAYS_INLINE inline void
+  load_converted(dealii::VectorizedArray<Number, width> &result,
+                 const StorageNumber *ptr)
+  {
+    if constexpr (std::is_same_v<Number, StorageNumber>) {
+      result.load(ptr);
+      return;
+    }
+
+    if constexpr (std::is_same_v<Number, double> &&
+                  std::is_same_v<StorageNumber, float>) {
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 3 && defined(__AVX512F__)
+      if constexpr (width == 8) {
+        result.data = _mm512_cvtps_pd(_mm256_loadu_ps(ptr));
+        return;
+      }
+#endif
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 2 && defined(__AVX__)
+      if constexpr (width == 4) {
+        result.data = _mm256_cvtps_pd(_mm_loadu_ps(ptr));
+        return;
+      }
+#endif
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 1 && defined(__SSE2__)
+      if constexpr (width == 2) {
+        result.data = _mm_cvtps_pd(_mm_castsi128_ps(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr))));
+        return;
+      }
+#endif
+    }
+
+    /* Fallback: */
+    for (unsigned int k = 0; k < width; ++k)
+      result[k] = ptr[k];
+  }
+
+
+  /**
+   * Variant of load_converted() that gathers the values
+   * { base[indices[0]], ..., base[indices[VectorizedArray::size() - 1]] }.
+   *
+   * @ingroup SIMD
+   */
+  template <typename Number, std::size_t width, typename StorageNumber>
+  DEAL_II_ALWAYS_INLINE inline void
+  gather_converted(dealii::VectorizedArray<Number, width> &result,
+                   const StorageNumber *base,
+                   const unsigned int *indices)
+  {
+    if constexpr (std::is_same_v<Number, StorageNumber>) {
+      result.gather(base, indices);
+      return;
+    }
+
+    if constexpr (std::is_same_v<Number, double> &&
+                  std::is_same_v<StorageNumber, float>) {
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 3 && defined(__AVX512F__)
+      if constexpr (width == 8) {
+        const __m256i index = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(indices));
+        result.data = _mm512_cvtps_pd(_mm256_i32gather_ps(base, index, 4));
+        return;
+      }
+#endif
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 2 && defined(__AVX2__)
+      if constexpr (width == 4) {
+        const __m128i index =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+        result.data = _mm256_cvtps_pd(_mm_i32gather_ps(base, index, 4));
+        return;
+      }
+#endif
+    }
+
+    /* Fallback: */
+    for (unsigned int k = 0; k < width; ++k)
+      result[k] = base[indices[k]];
+  }
+
+
+  /**
+   * Convert the VectorizedArray @p value to @p StorageNumber and store it
+   * in VectorizedArray::size() consecutive entries starting at @p ptr.
+   *
+   * @ingroup SIMD
+   */
+  template <typename Number, std::size_t width, typename StorageNumber>
+  DEAL_II_ALWAYS_INLINE inline void
+  store_converted(const dealii::VectorizedArray<Number, width> &value,
+                  StorageNumber *ptr)
+  {
+    if constexpr (std::is_same_v<Number, StorageNumber>) {
+      value.store(ptr);
+      return;
+    }
+
+    if constexpr (std::is_same_v<Number, double> &&
+                  std::is_same_v<StorageNumber, float>) {
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 3 && defined(__AVX512F__)
+      if constexpr (width == 8) {
+        _mm256_storeu_ps(ptr, _mm512_cvtpd_ps(value.data));
+        return;
+      }
+#endif
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 2 && defined(__AVX__)
+      if constexpr (width == 4) {
+        _mm_storeu_ps(ptr, _mm256_cvtpd_ps(value.data));
+        return;
+      }
+#endif
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 1 && defined(__SSE2__)
+      if constexpr (width == 2) {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(ptr),
+                         _mm_castps_si128(_mm_cvtpd_ps(value.data)));
+        return;
+      }
+#endif
+    }
+
+    /* Fallback: */
+    for (unsigned int k = 0; k < width; ++k)
+      ptr[k] = value[k];
+  }
+
   //@}
 
 } // namespace ryujin
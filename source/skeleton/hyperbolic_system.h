@@ -229,9 +229,23 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 0;
 
+      /**
+       * Set to true if the first precomputation cycle only depends on the
+       * state of the current row. HyperbolicModule then fuses it into the
+       * final write-back loop of the preceding step() by calling a
+       * function <code>precomputed_type row_precomputation(const
+       * state_type &U_i) const</code>.
+       */
+      static constexpr bool have_row_local_precomputation = false;
+
       /**
        * Precompute values for hyperbolic update. This routine is called
        * within our usual loop() idiom in HyperbolicModule
+       *
+       * @note The first cycle (cycle = 0) must only access the state of
+       * locally owned degrees of freedom: HyperbolicModule exchanges the
+       * ghost values of the state vector together with the precomputed
+       * values of the first cycle.
        */
       template <typename DISPATCH, typename SPARSITY>
       void precomputation_loop(unsigned int /*cycle*/,
@@ -16,4 +16,19 @@ namespace ryujin
   template class SparseMatrixSIMD<NUMBER, 1>;
   template class SparseMatrixSIMD<NUMBER, 2>;
   template class SparseMatrixSIMD<NUMBER, 3>;
+
+#ifdef MIXED_PRECISION_OFFLINE_MATRICES
+  template class SparseMatrixSIMD<NUMBER,
+                                  1,
+                                  dealii::VectorizedArray<NUMBER>::size(),
+                                  float>;
+  template class SparseMatrixSIMD<NUMBER,
+                                  2,
+                                  dealii::VectorizedArray<NUMBER>::size(),
+                                  float>;
+  template class SparseMatrixSIMD<NUMBER,
+                                  3,
+                                  dealii::VectorizedArray<NUMBER>::size(),
+                                  float>;
+#endif
 } /* namespace ryujin */
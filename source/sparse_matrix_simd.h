@@ -9,9 +9,13 @@
 #include <deal.II/base/partitioner.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 
+#include "numa.h"
 #include "openmp.h"
+#include "persistent_requests.h"
 #include "simd.h"
 
+#include <cstdint>
+
 namespace ryujin
 {
   namespace
@@ -34,7 +38,8 @@ namespace ryujin
 
   template <typename Number,
             int n_components = 1,
-            int simd_length = dealii::VectorizedArray<Number>::size()>
+            int simd_length = dealii::VectorizedArray<Number>::size(),
+            typename StorageNumber = Number>
   class SparseMatrixSIMD;
 
   /**
@@ -58,6 +63,15 @@ namespace ryujin
    * For the non-vectorized row index region [n_internal_dofs,
    * n_locally_relevant_dofs) we store the matrix in CSR format (equivalent
    * to the static dealii::SparsityPattern).
+   *
+   * Optionally, column indices and transposed indices can be stored in a
+   * compressed 16-bit format. In this case every row chunk (a group of
+   * simd_length rows in the vectorized region, or a single row in the CSR
+   * region) stores a 32-bit base column index and a 32-bit base
+   * transposed index, and every entry stores two 16-bit offsets relative
+   * to these bases. Chunks whose column indices or transposed indices span
+   * more than 2^16 indices fall back to 32-bit storage. Only these chunks
+   * are kept in the 32-bit column index and transposed index arrays.
    */
   template <int simd_length>
   class SparsityPatternSIMD
@@ -77,18 +91,22 @@ namespace ryujin
         const unsigned int n_internal_dofs,
         const dealii::DynamicSparsityPattern &sparsity,
         const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
-            &partitioner);
+            &partitioner,
+        const bool compress_indices = false);
 
 
     /**
      * Reinit function that reinitializes the SIMD sparsity pattern for a
      * given sparsity pattern template, an MPI partitioner and the number
-     * of (regular) internal dofs.
+     * of (regular) internal dofs. If @p compress_indices is set to true
+     * column indices and transposed indices are additionally stored in a
+     * compressed 16-bit format (see the class documentation).
      */
     void reinit(const unsigned int n_internal_dofs,
                 const dealii::DynamicSparsityPattern &sparsity,
                 const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
-                    &partitioner);
+                    &partitioner,
+                const bool compress_indices = false);
 
     /**
      * Return the "stride size" of a given row index. The function returns
@@ -97,15 +115,72 @@ namespace ryujin
      */
     unsigned int stride_of_row(const unsigned int row) const;
 
+    /**
+     * Return a pointer to the column indices of a given row. Consecutive
+     * column indices are stored with stride stride_of_row().
+     *
+     * @note This variant is not available if compressed indices are in
+     * use. Use the variant taking a buffer instead.
+     */
     const unsigned int *columns(const unsigned int row) const;
 
+    /**
+     * Return a pointer to the column indices of a given row. Consecutive
+     * column indices are stored with stride stride_of_row().
+     *
+     * If compressed indices are in use the column indices of the row
+     * chunk are decoded into the caller provided @p buffer (which is
+     * resized if necessary) and the returned pointer points into
+     * @p buffer. For a row at the SIMD granularity the whole row chunk is
+     * decoded so that vectorized access through the returned pointer is
+     * possible. The pointer stays valid until @p buffer is modified.
+     */
+    const unsigned int *
+    columns(const unsigned int row,
+            dealii::AlignedVector<unsigned int> &buffer) const;
+
     unsigned int row_length(const unsigned int row) const;
 
     unsigned int n_rows() const;
 
     std::size_t n_nonzero_elements() const;
 
+    /**
+     * Return true if column indices and transposed indices are stored in
+     * compressed 16-bit format.
+     */
+    bool compressed_indices() const;
+
   protected:
+    /**
+     * Compute the compressed 16-bit representation of column_indices and
+     * indices_transposed. Afterwards, column_indices and
+     * indices_transposed only contain the row chunks that could not be
+     * compressed.
+     */
+    void compress();
+
+    /**
+     * Return the index into row_starts (and chunk_base) of the row chunk
+     * containing @p row.
+     */
+    unsigned int chunk_of_row(const unsigned int row) const;
+
+    /**
+     * Return the column index stored at @p position in the column array.
+     * The row chunk @p chunk must contain @p position.
+     */
+    unsigned int column_index(const unsigned int chunk,
+                              const std::size_t position) const;
+
+    /**
+     * Return the index into the data array of the transposed entry for
+     * the entry stored at @p position in the column array. The row chunk
+     * @p chunk must contain @p position.
+     */
+    unsigned int transposed_index(const unsigned int chunk,
+                                  const std::size_t position) const;
+
     unsigned int n_internal_dofs;
     unsigned int n_locally_owned_dofs;
     std::shared_ptr<const dealii::Utilities::MPI::Partitioner> partitioner;
@@ -114,6 +189,31 @@ namespace ryujin
     dealii::AlignedVector<unsigned int> column_indices;
     dealii::AlignedVector<unsigned int> indices_transposed;
 
+    /**
+     * Compressed storage: For every row chunk the base column index, or
+     * dealii::numbers::invalid_unsigned_int if the chunk is stored
+     * uncompressed in column_indices. Indexed the same way as row_starts.
+     */
+    dealii::AlignedVector<unsigned int> chunk_base;
+
+    /**
+     * Compressed storage: For every row chunk the base transposed index.
+     * For a chunk stored uncompressed this is instead the start of the
+     * chunk within column_indices and indices_transposed.
+     */
+    dealii::AlignedVector<unsigned int> chunk_transposed_base;
+
+    /**
+     * Compressed storage: Column index offsets relative to chunk_base.
+     */
+    dealii::AlignedVector<std::uint16_t> column_offsets;
+
+    /**
+     * Compressed storage: Transposed index offsets relative to
+     * chunk_transposed_base.
+     */
+    dealii::AlignedVector<std::uint16_t> transposed_offsets;
+
     /**
      * Array listing all (locally owned) entries as a pair {row,
      * position_within_column}, potentially duplicated, and arranged
@@ -143,7 +243,7 @@ namespace ryujin
 
     MPI_Comm mpi_communicator;
 
-    template <typename, int, int>
+    template <typename, int, int, typename>
     friend class SparseMatrixSIMD;
   };
 
@@ -156,8 +256,18 @@ namespace ryujin
    * SparsityPatternSIMD for details). For the non-vectorized row index
    * region [n_internal_dofs, n_locally_relevant_dofs) we store the matrix in
    * CSR format (equivalent to the static dealii::SparsityPattern).
+   *
+   * The optional template parameter @p StorageNumber selects the
+   * floating point type used for storing matrix entries. If it differs
+   * from @p Number (for example, storing in single precision while
+   * computing in double precision) all entries are converted to
+   * @p Number (or a VectorizedArray thereof) when loaded and converted
+   * back to @p StorageNumber when written.
    */
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   class SparseMatrixSIMD
   {
   public:
@@ -165,7 +275,21 @@ namespace ryujin
 
     SparseMatrixSIMD(const SparsityPatternSIMD<simd_length> &sparsity);
 
-    void reinit(const SparsityPatternSIMD<simd_length> &sparsity);
+    /**
+     * Reinitialize the matrix for the given @p sparsity pattern and set
+     * all entries to zero. The entries are first-touched in a parallel
+     * region with the same static schedule used by the compute kernels
+     * (see NUMA::first_touch()). If @p huge_pages is set to true, then
+     * the storage is advised to be backed by transparent huge pages.
+     */
+    void reinit(const SparsityPatternSIMD<simd_length> &sparsity,
+                const bool huge_pages = false);
+
+    /**
+     * Return the number of memory pages of the matrix storage that reside
+     * on each NUMA node (see NUMA::page_placement()).
+     */
+    std::vector<std::size_t> page_placement() const;
 
     template <typename SparseMatrix>
     void read_in(const std::array<SparseMatrix, n_components> &sparse_matrix,
@@ -290,7 +414,20 @@ namespace ryujin
 
     /* Synchronize over MPI ranks: */
 
-    void update_ghost_rows_start(const unsigned int communication_channel = 0);
+    /**
+     * Start the exchange of all ghost rows. The exchange uses persistent
+     * MPI requests that are set up on the first exchange for a given
+     * @p communication_channel and @p precision and reused afterwards
+     * until the next call to reinit().
+     *
+     * With a reduced payload @p precision all entries are rounded down
+     * before they are sent, and the locally owned entries that are sent
+     * are overwritten with the rounded values. This way the entries of
+     * coupled rows on different MPI ranks remain bitwise identical.
+     */
+    void update_ghost_rows_start(
+        const unsigned int communication_channel = 0,
+        const PayloadPrecision precision = PayloadPrecision::full);
 
     void update_ghost_rows_finish();
 
@@ -298,9 +435,9 @@ namespace ryujin
 
   protected:
     const SparsityPatternSIMD<simd_length> *sparsity;
-    dealii::AlignedVector<Number> data;
-    dealii::AlignedVector<Number> exchange_buffer;
-    std::vector<MPI_Request> requests;
+    dealii::AlignedVector<StorageNumber> data;
+    PersistentRequests<StorageNumber> requests;
+    typename PersistentRequests<StorageNumber>::RequestSet *active_requests;
   };
 
   /*
@@ -327,6 +464,10 @@ namespace ryujin
   {
     AssertIndexRange(row, row_starts.size() - 1);
 
+    Assert(!compressed_indices(),
+           dealii::ExcMessage("Compressed column indices have to be decoded "
+                              "into a buffer"));
+
     if (row < n_internal_dofs)
       return column_indices.data() + row_starts[row / simd_length] +
              row % simd_length;
@@ -335,6 +476,51 @@ namespace ryujin
   }
 
 
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline const unsigned int *
+  SparsityPatternSIMD<simd_length>::columns(
+      const unsigned int row, dealii::AlignedVector<unsigned int> &buffer) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    const unsigned int chunk = chunk_of_row(row);
+    const unsigned int simd_offset =
+        row < n_internal_dofs ? row % simd_length : 0;
+
+    if (RYUJIN_LIKELY(column_offsets.size() == 0))
+      return column_indices.data() + row_starts[chunk] + simd_offset;
+
+    const unsigned int base = chunk_base[chunk];
+    if (base == dealii::numbers::invalid_unsigned_int)
+      return column_indices.data() + chunk_transposed_base[chunk] +
+             simd_offset;
+
+    /*
+     * Decode the compressed chunk. For a row at SIMD granularity we
+     * decode the whole chunk (so that vectorized access through the
+     * returned pointer works), otherwise only the strided entries
+     * belonging to the row itself.
+     */
+
+    const std::size_t begin = row_starts[chunk];
+    const std::size_t end = row_starts[chunk + 1];
+    if (buffer.size() < end - begin)
+      buffer.resize_fast(end - begin);
+
+    const std::uint16_t *offsets = column_offsets.data() + begin;
+
+    if (simd_offset == 0) {
+      for (std::size_t e = 0; e < end - begin; ++e)
+        buffer[e] = base + offsets[e];
+    } else {
+      for (std::size_t e = simd_offset; e < end - begin; e += simd_length)
+        buffer[e] = base + offsets[e];
+    }
+
+    return buffer.data() + simd_offset;
+  }
+
+
   template <int simd_length>
   DEAL_II_ALWAYS_INLINE inline unsigned int
   SparsityPatternSIMD<simd_length>::row_length(const unsigned int row) const
@@ -368,10 +554,62 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline bool
+  SparsityPatternSIMD<simd_length>::compressed_indices() const
+  {
+    return column_offsets.size() != 0;
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::chunk_of_row(const unsigned int row) const
+  {
+    return row < n_internal_dofs ? row / simd_length : row;
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::column_index(
+      const unsigned int chunk, const std::size_t position) const
+  {
+    if (RYUJIN_LIKELY(column_offsets.size() == 0))
+      return column_indices[position];
+
+    const unsigned int base = chunk_base[chunk];
+    if (base == dealii::numbers::invalid_unsigned_int)
+      return column_indices[chunk_transposed_base[chunk] + position -
+                            row_starts[chunk]];
+    else
+      return base + column_offsets[position];
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::transposed_index(
+      const unsigned int chunk, const std::size_t position) const
+  {
+    if (RYUJIN_LIKELY(column_offsets.size() == 0))
+      return indices_transposed[position];
+
+    if (chunk_base[chunk] == dealii::numbers::invalid_unsigned_int)
+      return indices_transposed[chunk_transposed_base[chunk] + position -
+                                row_starts[chunk]];
+    else
+      return chunk_transposed_base[chunk] + transposed_offsets[position];
+  }
+
+
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline auto
-  SparseMatrixSIMD<Number, n_components, simd_length>::get_entry(
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::get_entry(
       const unsigned int row, const unsigned int position_within_column) const
       -> EntryType<Number2>
   {
@@ -383,11 +621,15 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
-  SparseMatrixSIMD<Number, n_components, simd_length>::get_tensor(
-      const unsigned int row, const unsigned int position_within_column) const
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      get_tensor(const unsigned int row,
+                 const unsigned int position_within_column) const
   {
     Assert(sparsity != nullptr, dealii::ExcNotInitialized());
     AssertIndexRange(row, sparsity->row_starts.size() - 1);
@@ -431,13 +673,14 @@ namespace ryujin
              dealii::ExcMessage(
                  "Access only supported for rows at the SIMD granularity"));
 
-      const Number *load_pos =
+      const StorageNumber *load_pos =
           data.data() + (sparsity->row_starts[row / simd_length] +
                          position_within_column * simd_length) *
                             n_components;
 
+      /* Converts from StorageNumber during load if necessary: */
       for (unsigned int d = 0; d < n_components; ++d)
-        result[d].load(load_pos + d * simd_length);
+        load_converted(result[d], load_pos + d * simd_length);
 
     } else {
       /* not implemented */
@@ -448,11 +691,15 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline auto
-  SparseMatrixSIMD<Number, n_components, simd_length>::get_transposed_entry(
-      const unsigned int row, const unsigned int position_within_column) const
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      get_transposed_entry(const unsigned int row,
+                           const unsigned int position_within_column) const
       -> EntryType<Number2>
   {
     const auto result =
@@ -464,11 +711,16 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
-  SparseMatrixSIMD<Number, n_components, simd_length>::get_transposed_tensor(
-      const unsigned int row, const unsigned int position_within_column) const
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      get_transposed_tensor(
+          const unsigned int row,
+          const unsigned int position_within_column) const
   {
     Assert(sparsity != nullptr, dealii::ExcNotInitialized());
     AssertIndexRange(row, sparsity->row_starts.size() - 1);
@@ -486,15 +738,13 @@ namespace ryujin
         // go through vectorized part
         const unsigned int simd_row = row / simd_length;
         const unsigned int simd_offset = row % simd_length;
+        const std::size_t position = sparsity->row_starts[simd_row] +
+                                     simd_offset +
+                                     position_within_column * simd_length;
         const std::size_t index =
-            sparsity->indices_transposed[sparsity->row_starts[simd_row] +
-                                         simd_offset +
-                                         position_within_column * simd_length];
+            sparsity->transposed_index(simd_row, position);
         if (n_components > 1) {
-          const unsigned int col =
-              sparsity->column_indices[sparsity->row_starts[simd_row] +
-                                       simd_offset +
-                                       position_within_column * simd_length];
+          const unsigned int col = sparsity->column_index(simd_row, position);
           if (col < sparsity->n_internal_dofs)
             for (unsigned int d = 0; d < n_components; ++d)
               result[d] =
@@ -507,13 +757,11 @@ namespace ryujin
           result[0] = data[index];
       } else {
         // go through standard part
-        const std::size_t index =
-            sparsity->indices_transposed[sparsity->row_starts[row] +
-                                         position_within_column];
+        const std::size_t position =
+            sparsity->row_starts[row] + position_within_column;
+        const std::size_t index = sparsity->transposed_index(row, position);
         if (n_components > 1) {
-          const unsigned int col =
-              sparsity->column_indices[sparsity->row_starts[row] +
-                                       position_within_column];
+          const unsigned int col = sparsity->column_index(row, position);
           if (col < sparsity->n_internal_dofs)
             for (unsigned int d = 0; d < n_components; ++d)
               result[d] =
@@ -540,10 +788,22 @@ namespace ryujin
              dealii::ExcMessage(
                  "Access only supported for rows at the SIMD granularity"));
 
-      const unsigned int offset = sparsity->row_starts[row / simd_length] +
+      const unsigned int simd_row = row / simd_length;
+      const unsigned int offset = sparsity->row_starts[simd_row] +
                                   position_within_column * simd_length;
-      result[0].gather(data.data(),
-                       sparsity->indices_transposed.data() + offset);
+
+      const unsigned int *indices = sparsity->indices_transposed.data();
+      unsigned int decoded[simd_length];
+      if (sparsity->compressed_indices()) {
+        for (unsigned int k = 0; k < simd_length; ++k)
+          decoded[k] = sparsity->transposed_index(simd_row, offset + k);
+        indices = decoded;
+      } else {
+        indices += offset;
+      }
+
+      /* Converts from StorageNumber during load if necessary: */
+      gather_converted(result[0], data.data(), indices);
 
     } else {
       /* not implemented */
@@ -554,14 +814,17 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline void
-  SparseMatrixSIMD<Number, n_components, simd_length>::write_entry(
-      const Number2 entry,
-      const unsigned int row,
-      const unsigned int position_within_column,
-      const bool do_streaming_store)
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      write_entry(const Number2 entry,
+                  const unsigned int row,
+                  const unsigned int position_within_column,
+                  const bool do_streaming_store)
   {
     static_assert(
         n_components == 1,
@@ -579,14 +842,17 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline void
-  SparseMatrixSIMD<Number, n_components, simd_length>::write_entry(
-      const dealii::Tensor<1, n_components, Number2> &entry,
-      const unsigned int row,
-      const unsigned int position_within_column,
-      const bool do_streaming_store)
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      write_entry(const dealii::Tensor<1, n_components, Number2> &entry,
+                  const unsigned int row,
+                  const unsigned int position_within_column,
+                  const bool do_streaming_store)
   {
     Assert(sparsity != nullptr, dealii::ExcNotInitialized());
     AssertIndexRange(row, sparsity->row_starts.size() - 1);
@@ -628,16 +894,21 @@ namespace ryujin
              dealii::ExcMessage(
                  "Access only supported for rows at the SIMD granularity"));
 
-      Number *store_pos =
+      StorageNumber *store_pos =
           data.data() + (sparsity->row_starts[row / simd_length] +
                          position_within_column * simd_length) *
                             n_components;
-      if (do_streaming_store)
+      if constexpr (!std::is_same_v<Number, StorageNumber>) {
+        /* Convert to StorageNumber during store: */
+        for (unsigned int d = 0; d < n_components; ++d)
+          store_converted(entry[d], store_pos + d * simd_length);
+      } else if (do_streaming_store) {
         for (unsigned int d = 0; d < n_components; ++d)
           entry[d].streaming_store(store_pos + d * simd_length);
-      else
+      } else {
         for (unsigned int d = 0; d < n_components; ++d)
           entry[d].store(store_pos + d * simd_length);
+      }
 
     } else {
       /* not implemented */
@@ -646,10 +917,14 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   inline void
-  SparseMatrixSIMD<Number, n_components, simd_length>::update_ghost_rows_start(
-      const unsigned int communication_channel)
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      update_ghost_rows_start(const unsigned int communication_channel,
+                              const PayloadPrecision precision)
   {
 #ifdef DEAL_II_WITH_MPI
     AssertIndexRange(communication_channel, 200);
@@ -661,43 +936,103 @@ namespace ryujin
                dealii::Utilities::MPI::internal::Tags::partitioner_export_end,
            dealii::ExcInternalError());
 
-    const std::size_t n_indices = sparsity->entries_to_be_sent.size();
-    exchange_buffer.resize_fast(n_components * n_indices);
+    using Codec = PayloadCodec<StorageNumber>;
+    const std::size_t n_bytes = Codec::size(precision);
 
-    requests.resize(sparsity->receive_targets.size() +
-                    sparsity->send_targets.size());
+    const typename PersistentRequests<StorageNumber>::Key key{
+        {data.data()}, communication_channel, precision};
 
-    /*
-     * Set up MPI receive requests. We will always receive data for indices
-     * in the range [n_locally_owned_, n_locally_relevant_), thus the DATA
-     * is stored in non-vectorized CSR format.
-     */
+    auto *set = requests.find(key);
+    if (set == nullptr) {
+      set = &requests.create(key);
+
+      const auto &receive_targets = sparsity->receive_targets;
+      const auto &send_targets = sparsity->send_targets;
 
-    {
-      const auto &targets = sparsity->receive_targets;
-      for (unsigned int p = 0; p < targets.size(); ++p) {
-        const int ierr = MPI_Irecv(
-            data.data() +
-                n_components *
-                    (sparsity->row_starts[sparsity->n_locally_owned_dofs] +
-                     (p == 0 ? 0 : targets[p - 1].second)),
-            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
-                n_components * sizeof(Number),
+      set->n_receives = receive_targets.size();
+      set->requests.resize(receive_targets.size() + send_targets.size());
+      set->send_buffer.resize_fast(n_components *
+                                   sparsity->entries_to_be_sent.size());
+      set->precision = precision;
+
+      /*
+       * Set up persistent MPI receive requests. We will always receive
+       * data for indices in the range [n_locally_owned_,
+       * n_locally_relevant_), thus the DATA is stored in non-vectorized
+       * CSR format. Reduced precision payloads are staged in the receive
+       * buffer and decoded in update_ghost_rows_finish().
+       */
+
+      char *receive_data = reinterpret_cast<char *>(
+          data.data() +
+          n_components * sparsity->row_starts[sparsity->n_locally_owned_dofs]);
+
+      if (precision != PayloadPrecision::full && !receive_targets.empty()) {
+        set->receive_buffer.resize_fast(n_components *
+                                        receive_targets.back().second);
+        receive_data = reinterpret_cast<char *>(set->receive_buffer.data());
+      }
+
+      for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+        const int ierr = MPI_Recv_init(
+            receive_data + n_components *
+                               (p == 0 ? 0 : receive_targets[p - 1].second) *
+                               n_bytes,
+            (receive_targets[p].second -
+             (p == 0 ? 0 : receive_targets[p - 1].second)) *
+                n_components * n_bytes,
+            MPI_BYTE,
+            receive_targets[p].first,
+            mpi_tag,
+            sparsity->mpi_communicator,
+            &set->requests[p]);
+        AssertThrowMPI(ierr);
+      }
+
+      /*
+       * Set up persistent MPI send requests. The send buffer is populated
+       * on every exchange in a format compatible with the CSR storage
+       * format of the receiving MPI rank.
+       */
+
+      char *send_data = reinterpret_cast<char *>(set->send_buffer.data());
+
+      for (unsigned int p = 0; p < send_targets.size(); ++p) {
+        const int ierr = MPI_Send_init(
+            send_data + n_components *
+                            (p == 0 ? 0 : send_targets[p - 1].second) *
+                            n_bytes,
+            (send_targets[p].second -
+             (p == 0 ? 0 : send_targets[p - 1].second)) *
+                n_components * n_bytes,
             MPI_BYTE,
-            targets[p].first,
+            send_targets[p].first,
             mpi_tag,
             sparsity->mpi_communicator,
-            &requests[p]);
+            &set->requests[p + receive_targets.size()]);
         AssertThrowMPI(ierr);
       }
     }
 
+    PersistentRequests<StorageNumber>::start_receives(*set);
+
     /*
      * Copy all entries that we plan to send over to the exchange buffer.
      * Here, we have to be careful with indices falling into the "locally
      * internal" range that are stored in an array-of-struct-of-array type.
      */
 
+    auto &exchange_buffer = set->send_buffer;
+    const std::size_t n_indices = sparsity->entries_to_be_sent.size();
+
+    const auto pack = [&](const std::size_t index, const std::size_t k) {
+      if (precision == PayloadPrecision::full)
+        exchange_buffer[k] = data[index];
+      else
+        data[index] =
+            Codec::encode(data[index], precision, exchange_buffer.data(), k);
+    };
+
     for (std::size_t c = 0; c < n_indices; ++c) {
 
       const auto &[row, position_within_column] =
@@ -710,62 +1045,66 @@ namespace ryujin
         const unsigned int simd_row = row / simd_length;
         const unsigned int simd_offset = row % simd_length;
         for (unsigned int d = 0; d < n_components; ++d)
-          exchange_buffer[n_components * c + d] =
-              data[(sparsity->row_starts[simd_row] +
-                    position_within_column * simd_length) *
+          pack((sparsity->row_starts[simd_row] +
+                position_within_column * simd_length) *
                        n_components +
-                   d * simd_length + simd_offset];
+                   d * simd_length + simd_offset,
+               n_components * c + d);
       } else {
         // go through standard part
         for (unsigned int d = 0; d < n_components; ++d)
-          exchange_buffer[n_components * c + d] =
-              data[(sparsity->row_starts[row] + position_within_column) *
+          pack((sparsity->row_starts[row] + position_within_column) *
                        n_components +
-                   d];
+                   d,
+               n_components * c + d);
       }
     }
 
-    /*
-     * Set up MPI send requests. We have copied everything we intend to
-     * send to the exchange_buffer compatible with the CSR storage format
-     * of the receiving MPI rank.
-     */
+    PersistentRequests<StorageNumber>::start_sends(*set);
 
-    {
-      const auto &targets = sparsity->send_targets;
-      for (unsigned int p = 0; p < targets.size(); ++p) {
-        const int ierr = MPI_Isend(
-            exchange_buffer.data() +
-                n_components * (p == 0 ? 0 : targets[p - 1].second),
-            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
-                n_components * sizeof(Number),
-            MPI_BYTE,
-            targets[p].first,
-            mpi_tag,
-            sparsity->mpi_communicator,
-            &requests[p + sparsity->receive_targets.size()]);
-        AssertThrowMPI(ierr);
-      }
-    }
+    active_requests = set;
+#else
+    (void)communication_channel;
+    (void)precision;
 #endif
   }
 
 
-  template <typename Number, int n_components, int simd_length>
-  inline void SparseMatrixSIMD<Number, n_components, simd_length>::
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
+  inline void
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
       update_ghost_rows_finish()
   {
 #ifdef DEAL_II_WITH_MPI
-    const int ierr =
-        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
-    AssertThrowMPI(ierr);
+    Assert(active_requests != nullptr, dealii::ExcInternalError());
+    PersistentRequests<StorageNumber>::wait(*active_requests);
+
+    const auto precision = active_requests->precision;
+    if (precision != PayloadPrecision::full) {
+      const auto &receive_buffer = active_requests->receive_buffer;
+      auto *ghost_data =
+          data.data() +
+          n_components * sparsity->row_starts[sparsity->n_locally_owned_dofs];
+      for (std::size_t k = 0; k < receive_buffer.size(); ++k)
+        ghost_data[k] = PayloadCodec<StorageNumber>::decode(
+            precision, receive_buffer.data(), k);
+    }
+
+    active_requests = nullptr;
 #endif
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   inline void
-  SparseMatrixSIMD<Number, n_components, simd_length>::update_ghost_rows()
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      update_ghost_rows()
   {
     update_ghost_rows_start();
     update_ghost_rows_finish();
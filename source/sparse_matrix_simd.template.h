@@ -10,6 +10,8 @@
 #include <deal.II/base/vectorization.h>
 #include <deal.II/lac/sparse_matrix.h>
 
+#include <algorithm>
+
 namespace ryujin
 {
 
@@ -27,11 +29,12 @@ namespace ryujin
       const unsigned int n_internal_dofs,
       const dealii::DynamicSparsityPattern &sparsity,
       const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
-          &partitioner)
+          &partitioner,
+      const bool compress_indices)
       : n_internal_dofs(0)
       , mpi_communicator(MPI_COMM_SELF)
   {
-    reinit(n_internal_dofs, sparsity, partitioner);
+    reinit(n_internal_dofs, sparsity, partitioner, compress_indices);
   }
 
 
@@ -40,7 +43,8 @@ namespace ryujin
       const unsigned int n_internal_dofs,
       const dealii::DynamicSparsityPattern &dsp,
       const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
-          &partitioner)
+          &partitioner,
+      const bool compress_indices)
   {
     this->mpi_communicator = partitioner->get_mpi_communicator();
 
@@ -147,6 +151,14 @@ namespace ryujin
 
     Assert(col_ptr == column_indices.end(), dealii::ExcInternalError());
 
+    chunk_base.clear();
+    chunk_transposed_base.clear();
+    column_offsets.clear();
+    transposed_offsets.clear();
+
+    if (compress_indices)
+      compress();
+
     /* Compute the data exchange pattern: */
 
     if (sparsity.n_rows() > n_locally_owned_dofs) {
@@ -268,34 +280,175 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
-  SparseMatrixSIMD<Number, n_components, simd_length>::SparseMatrixSIMD()
+  template <int simd_length>
+  void SparsityPatternSIMD<simd_length>::compress()
+  {
+    constexpr unsigned int max_offset =
+        std::numeric_limits<std::uint16_t>::max();
+
+    const unsigned int n_chunks = row_starts.size() - 1;
+    chunk_base.resize_fast(n_chunks);
+    chunk_transposed_base.resize_fast(n_chunks);
+    column_offsets.resize_fast(column_indices.size());
+    transposed_offsets.resize_fast(column_indices.size());
+
+    /*
+     * Store column indices and transposed indices as 16-bit offsets
+     * relative to the smallest column index and smallest transposed index
+     * of each row chunk. Chunks with a larger spread of indices keep their
+     * 32-bit indices, which we move to the front of column_indices and
+     * indices_transposed:
+     */
+
+    std::size_t n_uncompressed = 0;
+
+    const auto compress_chunk = [&](const unsigned int chunk) {
+      const std::size_t begin = row_starts[chunk];
+      const std::size_t end = row_starts[chunk + 1];
+
+      const auto [min, max] = std::minmax_element(
+          column_indices.begin() + begin, column_indices.begin() + end);
+      const auto [min_t, max_t] =
+          std::minmax_element(indices_transposed.begin() + begin,
+                              indices_transposed.begin() + end);
+
+      if (begin == end || *max - *min > max_offset ||
+          *max_t - *min_t > max_offset) {
+        chunk_base[chunk] = dealii::numbers::invalid_unsigned_int;
+        chunk_transposed_base[chunk] = n_uncompressed;
+        for (std::size_t e = begin; e < end; ++e, ++n_uncompressed) {
+          column_offsets[e] = 0;
+          transposed_offsets[e] = 0;
+          column_indices[n_uncompressed] = column_indices[e];
+          indices_transposed[n_uncompressed] = indices_transposed[e];
+        }
+        return;
+      }
+
+      chunk_base[chunk] = *min;
+      chunk_transposed_base[chunk] = *min_t;
+      for (std::size_t e = begin; e < end; ++e) {
+        column_offsets[e] = column_indices[e] - *min;
+        transposed_offsets[e] = indices_transposed[e] - *min_t;
+      }
+    };
+
+#ifdef DEBUG
+    const auto column_indices_copy = column_indices;
+    const auto indices_transposed_copy = indices_transposed;
+#endif
+
+    for (unsigned int i = 0; i < n_internal_dofs; i += simd_length)
+      compress_chunk(i / simd_length);
+
+    for (unsigned int i = n_internal_dofs; i < n_chunks; ++i)
+      compress_chunk(i);
+
+    /* Release the memory of compressed chunks: */
+
+    const auto shrink = [n_uncompressed](auto &indices) {
+      dealii::AlignedVector<unsigned int> temp(n_uncompressed);
+      std::copy(
+          indices.begin(), indices.begin() + n_uncompressed, temp.begin());
+      indices.swap(temp);
+    };
+
+    shrink(column_indices);
+    shrink(indices_transposed);
+
+#ifdef DEBUG
+    for (unsigned int i = 0; i < n_chunks; ++i) {
+      if (i >= n_internal_dofs / simd_length && i < n_internal_dofs)
+        continue;
+      for (std::size_t e = row_starts[i]; e < row_starts[i + 1]; ++e) {
+        Assert(column_index(i, e) == column_indices_copy[e],
+               dealii::ExcInternalError());
+        Assert(transposed_index(i, e) == indices_transposed_copy[e],
+               dealii::ExcInternalError());
+      }
+    }
+#endif
+  }
+
+
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      SparseMatrixSIMD()
       : sparsity(nullptr)
+      , active_requests(nullptr)
   {
   }
 
 
-  template <typename Number, int n_components, int simd_length>
-  SparseMatrixSIMD<Number, n_components, simd_length>::SparseMatrixSIMD(
-      const SparsityPatternSIMD<simd_length> &sparsity)
-      : sparsity(&sparsity)
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      SparseMatrixSIMD(const SparsityPatternSIMD<simd_length> &sparsity)
+      : sparsity(nullptr)
+      , active_requests(nullptr)
   {
-    data.resize(sparsity.n_nonzero_elements() * n_components);
+    reinit(sparsity);
   }
 
 
-  template <typename Number, int n_components, int simd_length>
-  void SparseMatrixSIMD<Number, n_components, simd_length>::reinit(
-      const SparsityPatternSIMD<simd_length> &sparsity)
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
+  void SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      reinit(const SparsityPatternSIMD<simd_length> &sparsity,
+             const bool huge_pages)
   {
     this->sparsity = &sparsity;
-    data.resize(sparsity.n_nonzero_elements() * n_components);
+
+    /* The persistent requests are bound to the old storage: */
+    requests.clear();
+    active_requests = nullptr;
+
+    data.resize_fast(sparsity.n_nonzero_elements() * n_components);
+
+    const auto row_range = [&](const unsigned int i, const unsigned int n) {
+      const auto &row_starts = sparsity.row_starts;
+      return std::make_pair(
+          row_starts[sparsity.chunk_of_row(i)] * n_components,
+          row_starts[sparsity.chunk_of_row(i + n)] * n_components);
+    };
+
+    NUMA::first_touch(data.data(),
+                      data.size(),
+                      sparsity.n_internal_dofs,
+                      sparsity.n_rows(),
+                      simd_length,
+                      row_range,
+                      huge_pages);
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
+  std::vector<std::size_t>
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::
+      page_placement() const
+  {
+    return NUMA::page_placement(data.data(),
+                                data.size() * sizeof(StorageNumber));
+  }
+
+
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename SparseMatrix>
-  void SparseMatrixSIMD<Number, n_components, simd_length>::read_in(
+  void
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::read_in(
       const std::array<SparseMatrix, n_components> &sparse_matrix,
       bool locally_indexed /*= true*/)
   {
@@ -308,12 +461,15 @@ namespace ryujin
      * the sparse_matrix object.
      */
 
+    /* Stored thread locally: */
+    dealii::AlignedVector<unsigned int> column_buffer;
+
     RYUJIN_OMP_FOR
     for (unsigned int i = 0; i < sparsity->n_internal_dofs; i += simd_length) {
 
       const unsigned int row_length = sparsity->row_length(i);
 
-      const unsigned int *js = sparsity->columns(i);
+      const unsigned int *js = sparsity->columns(i, column_buffer);
       for (unsigned int col_idx = 0; col_idx < row_length;
            ++col_idx, js += simd_length) {
 
@@ -336,7 +492,7 @@ namespace ryujin
          i < sparsity->n_locally_owned_dofs;
          ++i) {
       const unsigned int row_length = sparsity->row_length(i);
-      const unsigned int *js = sparsity->columns(i);
+      const unsigned int *js = sparsity->columns(i, column_buffer);
       for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx, ++js) {
 
         dealii::Tensor<1, n_components, Number> temp;
@@ -355,9 +511,13 @@ namespace ryujin
   }
 
 
-  template <typename Number, int n_components, int simd_length>
+  template <typename Number,
+            int n_components,
+            int simd_length,
+            typename StorageNumber>
   template <typename SparseMatrix>
-  void SparseMatrixSIMD<Number, n_components, simd_length>::read_in(
+  void
+  SparseMatrixSIMD<Number, n_components, simd_length, StorageNumber>::read_in(
       const SparseMatrix &sparse_matrix, bool locally_indexed /*= true*/)
   {
     RYUJIN_PARALLEL_REGION_BEGIN
@@ -369,12 +529,15 @@ namespace ryujin
      * the sparse_matrix object.
      */
 
+    /* Stored thread locally: */
+    dealii::AlignedVector<unsigned int> column_buffer;
+
     RYUJIN_OMP_FOR
     for (unsigned int i = 0; i < sparsity->n_internal_dofs; i += simd_length) {
 
       const unsigned int row_length = sparsity->row_length(i);
 
-      const unsigned int *js = sparsity->columns(i);
+      const unsigned int *js = sparsity->columns(i, column_buffer);
       for (unsigned int col_idx = 0; col_idx < row_length;
            ++col_idx, js += simd_length) {
 
@@ -397,7 +560,7 @@ namespace ryujin
          ++i) {
 
       const unsigned int row_length = sparsity->row_length(i);
-      const unsigned int *js = sparsity->columns(i);
+      const unsigned int *js = sparsity->columns(i, column_buffer);
       for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx, ++js) {
 
         const Number temp =
@@ -53,7 +53,9 @@ namespace ryujin
 
     /**
      * Helper function that (re)initializes all components of a StateVector
-     * to proper sizes.
+     * to proper sizes. The hyperbolic state and precomputed values are
+     * first-touched with the static schedule of the compute kernels (see
+     * MultiComponentVector::first_touch()).
      */
     template <
         typename Description,
@@ -69,7 +71,9 @@ namespace ryujin
     {
       auto &[U, precomputed, V] = state_vector;
       U.reinit(offline_data.hyperbolic_vector_partitioner());
+      U.first_touch(offline_data.n_locally_internal());
       precomputed.reinit(offline_data.precomputed_vector_partitioner());
+      precomputed.first_touch(offline_data.n_locally_internal());
     }
   } // namespace Vectors
 
@@ -15,6 +15,8 @@
 
 #include <deal.II/base/smartpointer.h>
 
+#include <array>
+
 namespace ryujin
 {
   /**
@@ -36,6 +38,22 @@ namespace ryujin
      * warning is emitted.
      */
     bang_bang_control,
+
+    /**
+     * Adaptively control the CFL number within the interval ["cfl min",
+     * "cfl max"]. In case an invariant domain and or CFL condition
+     * violation is detected, the CFL number is reduced by the "cfl
+     * reduction factor" and the time step is repeated (with a warning
+     * instead of a further restart once "cfl min" is reached). After a
+     * successful step the CFL number is increased by (at most) the "cfl
+     * growth factor" provided that (a) the low-order update of the step
+     * would have stayed within the limiter bounds with the increased CFL
+     * number, and (b) the recent restart rate (an exponential moving
+     * average over roughly the last 20 steps) is below the "cfl target
+     * restart rate". The growth is damped when the restart rate
+     * approaches the target.
+     */
+    adaptive_control,
   };
 
 
@@ -126,6 +144,45 @@ namespace ryujin
      */
     erk_54,
 
+    /**
+     * The four stage, third-order strong stability preserving Runge Kutta
+     * method SSPRK(4,3;1/2) of Kraaijevanger in its low-storage Shu-Osher
+     * form. It only needs two temporary state vectors (as does SSPRK(3,3)),
+     * but has an SSP coefficient of 2, i.e., it takes steps twice as large
+     * as SSPRK(3,3) for the same number of stages per unit time.
+     */
+    ssprk_43_ls,
+
+    /**
+     * A low-storage variant of the three stage, third-order Runge-Kutta
+     * method using Williamson's 2N-storage formulation. Only the stage
+     * state, a scratch state and a single increment vector are kept in
+     * memory (one more state vector if restarts are enabled by the CFL
+     * recovery strategy).
+     *
+     * @note Contrary to the erk schemes, stage increments are combined
+     * after the limiter has been applied. The low-storage variants are
+     * thus not invariant domain preserving: the increment
+     * \f$U \leftarrow U + b_k\,dU\f$ contains the previous increment
+     * with the (negative) weight \f$a_k\f$. The time step size is chosen
+     * such that the forward Euler part of every stage is a convex
+     * combination, i.e., \f$\max_k b_k\,\Delta t\f$ equals the forward
+     * Euler step size. This results in an efficiency of 16/15 (instead of
+     * 3 for erk_33). The low-storage variants are meant for smooth
+     * problems where memory limits the problem size.
+     */
+    erk_33_ls,
+
+    /**
+     * A low-storage variant of a five stage, fourth-order Runge-Kutta
+     * method: the 2N-storage RK4(3)5 scheme of Carpenter and Kennedy. The
+     * storage requirements are those of erk_33_ls.
+     *
+     * @note The scheme is not invariant domain preserving, see
+     * erk_33_ls. Its efficiency is 1.43 (instead of 5 for erk_54).
+     */
+    erk_54_ls,
+
     /**
      * A Strang split using ssprk 33 for the hyperbolic subproblem and
      * Crank-Nicolson for the parabolic subproblem
@@ -210,7 +267,9 @@ namespace ryujin
 DECLARE_ENUM(ryujin::CFLRecoveryStrategy,
              LIST({ryujin::CFLRecoveryStrategy::none, "none"},
                   {ryujin::CFLRecoveryStrategy::bang_bang_control,
-                   "bang bang control"}));
+                   "bang bang control"},
+                  {ryujin::CFLRecoveryStrategy::adaptive_control,
+                   "adaptive control"}));
 
 DECLARE_ENUM(
     ryujin::TimeSteppingScheme,
@@ -221,6 +280,9 @@ DECLARE_ENUM(
          {ryujin::TimeSteppingScheme::erk_33, "erk 33"},
          {ryujin::TimeSteppingScheme::erk_43, "erk 43"},
          {ryujin::TimeSteppingScheme::erk_54, "erk 54"},
+         {ryujin::TimeSteppingScheme::ssprk_43_ls, "ssprk 43 ls"},
+         {ryujin::TimeSteppingScheme::erk_33_ls, "erk 33 ls"},
+         {ryujin::TimeSteppingScheme::erk_54_ls, "erk 54 ls"},
          {ryujin::TimeSteppingScheme::strang_ssprk_33_cn, "strang ssprk 33 cn"},
          {ryujin::TimeSteppingScheme::strang_erk_33_cn, "strang erk 33 cn"},
          {ryujin::TimeSteppingScheme::strang_erk_43_cn, "strang erk 43 cn"},
@@ -314,6 +376,34 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(efficiency);
 
+    /**
+     * The memory (in bytes) occupied by all temporary vectors of the
+     * selected time-stepping scheme.
+     */
+    ACCESSOR_READ_ONLY(temporary_memory);
+
+    /**
+     * The memory (in bytes) saved by a low-storage time-stepping scheme
+     * compared to the temporary vectors of the corresponding standard
+     * scheme (erk 33 for erk 33 ls, erk 54 for erk 54 ls). Zero for all
+     * other schemes.
+     */
+    ACCESSOR_READ_ONLY(saved_memory);
+
+    /**
+     * Print a status line with statistics about the CFL numbers of all
+     * accepted time steps and the number of restarted time steps to the
+     * output stream @p output.
+     */
+    void print_cfl_statistics(std::ostream &output) const;
+
+    /**
+     * The (normalized) embedded error estimate of the last time step, see
+     * the "embedded error tolerance" parameter. A value less than or equal
+     * to 1 indicates that the estimated local error was within tolerance.
+     */
+    ACCESSOR_READ_ONLY(embedded_error);
+
   protected:
     /**
      * Given a reference to a previous state vector U performs an explicit
@@ -341,6 +431,18 @@ namespace ryujin
      */
     Number step_erk_11(StateVector &state_vector, Number t, Number tau_max);
 
+    /**
+     * Multirate variant of step_erk_11() used if the "multirate levels"
+     * parameter of the HyperbolicModule is nonzero: performs a cycle of
+     * 2^L forward Euler substeps in which every row advances with its own
+     * local time step size (see HyperbolicModule::multirate_substep()).
+     * The function returns the combined time step size of the cycle,
+     * which is guaranteed to be less than or equal to the parameter @p
+     * tau_max.
+     */
+    Number
+    step_erk_11_multirate(StateVector &state_vector, Number t, Number tau_max);
+
     /**
      * Given a reference to a previous state vector U performs an explicit
      * second-order Runge-Kutta ERK(2,2;1) time step (and store the result
@@ -375,6 +477,70 @@ namespace ryujin
      */
     Number step_erk_54(StateVector &state_vector, Number t, Number tau_max);
 
+    /**
+     * Given a reference to a previous state vector U performs a
+     * low-storage, strong-stability preserving Runge-Kutta SSPRK(4,3;1/2)
+     * time step (and store the result in U). The function returns the
+     * chosen time step size tau, which is guaranteed to be less than or
+     * equal to the parameter @p tau_max.
+     */
+    Number
+    step_ssprk_43_ls(StateVector &state_vector, Number t, Number tau_max);
+
+    /**
+     * Given a reference to a previous state vector U performs a
+     * low-storage, third-order Runge-Kutta time step in 2N-storage form
+     * (and store the result in U). The function returns the chosen time
+     * step size tau, which is guaranteed to be less than or equal to the
+     * parameter @p tau_max.
+     */
+    Number step_erk_33_ls(StateVector &state_vector, Number t, Number tau_max);
+
+    /**
+     * Given a reference to a previous state vector U performs a
+     * low-storage, fourth-order Runge-Kutta time step in 2N-storage form
+     * (and store the result in U). The function returns the chosen time
+     * step size tau, which is guaranteed to be less than or equal to the
+     * parameter @p tau_max.
+     */
+    Number step_erk_54_ls(StateVector &state_vector, Number t, Number tau_max);
+
+    /**
+     * Internally used: returns the embedded error estimate
+     * \f{align*}
+     *   E = \sum_k w_k\,(T_k - U_{\text{old}})
+     * \f}
+     * of a Runge-Kutta step with stage states T_k, measured in the
+     * (lumped mass) L2 norm with every component scaled by the
+     * corresponding component of the old nodal state (bounded from below
+     * by a fraction of its root mean square), and divided by the
+     * "embedded error tolerance".
+     */
+    template <std::size_t n_stages>
+    Number embedded_error(
+        const StateVector &old_state_vector,
+        std::array<std::reference_wrapper<const StateVector>, n_stages>
+            stage_state_vectors,
+        const std::array<Number, n_stages> &weights) const;
+
+    /**
+     * Internally used: performs a time step with a Runge-Kutta method in
+     * Williamson's 2N-storage form
+     * \f{align*}
+     *   dU \leftarrow a_k\,dU + \Delta t\,L(U),\quad
+     *   U \leftarrow U + b_k\,dU,
+     * \f}
+     * with stage times t + c_k \Delta t. Here, \Delta t = n_stages * tau
+     * and tau L(U) is computed by a forward Euler step of size tau.
+     */
+    template <std::size_t n_stages>
+    Number step_low_storage_2n(StateVector &state_vector,
+                               Number t,
+                               Number tau_max,
+                               const std::array<Number, n_stages> &a,
+                               const std::array<Number, n_stages> &b,
+                               const std::array<Number, n_stages> &c);
+
     /**
      * Given a reference to a previous state vector U performs a combined
      * explicit implicit Strang split using a third-order Runge-Kutta
@@ -442,9 +608,17 @@ namespace ryujin
     Number cfl_max_;
 
     CFLRecoveryStrategy cfl_recovery_strategy_;
+    Number cfl_growth_factor_;
+    Number cfl_reduction_factor_;
+    Number cfl_target_restart_rate_;
+
+    Number embedded_error_tolerance_;
+    Number embedded_cfl_max_;
 
     TimeSteppingScheme time_stepping_scheme_;
     double efficiency_;
+    std::size_t temporary_memory_;
+    std::size_t saved_memory_;
 
     //@}
 
@@ -464,6 +638,25 @@ namespace ryujin
 
     std::vector<StateVector> temp_;
 
+    /* Adaptive CFL control: current CFL number and recent restart rate */
+    Number adaptive_cfl_;
+    Number restart_rate_;
+
+    /* CFL and restart statistics of all (accepted) time steps: */
+    unsigned int n_accepted_steps_;
+    unsigned int n_restarted_steps_;
+    Number cfl_sum_;
+    Number cfl_min_used_;
+    Number cfl_max_used_;
+
+    /* Embedded error control: CFL number proposed for the next step */
+    bool embedded_control_;
+    Number embedded_cfl_;
+    Number embedded_error_;
+
+    /* Increment register of the 2N-storage schemes: */
+    Vectors::MultiComponentVector<Number, View::problem_dimension> increment_;
+
     //@}
   };
 
@@ -5,8 +5,13 @@
 
 #pragma once
 
+#include "openmp.h"
 #include "time_integrator.h"
 
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
 namespace ryujin
 {
   using namespace dealii;
@@ -33,10 +38,22 @@ namespace ryujin
       const ParabolicModule<Description, dim, Number> &parabolic_module,
       const std::string &subsection /*= "TimeIntegrator"*/)
       : ParameterAcceptor(subsection)
+      , temporary_memory_(0)
+      , saved_memory_(0)
       , mpi_communicator_(mpi_communicator)
       , offline_data_(&offline_data)
       , hyperbolic_module_(&hyperbolic_module)
       , parabolic_module_(&parabolic_module)
+      , adaptive_cfl_(0.)
+      , restart_rate_(0.)
+      , n_accepted_steps_(0)
+      , n_restarted_steps_(0)
+      , cfl_sum_(0.)
+      , cfl_min_used_(std::numeric_limits<Number>::max())
+      , cfl_max_used_(0.)
+      , embedded_control_(false)
+      , embedded_cfl_(0.)
+      , embedded_error_(0.)
   {
     cfl_min_ = Number(0.45);
     add_parameter(
@@ -56,7 +73,46 @@ namespace ryujin
     add_parameter("cfl recovery strategy",
                   cfl_recovery_strategy_,
                   "CFL/invariant domain violation recovery strategy: none, "
-                  "bang bang control");
+                  "bang bang control, adaptive control");
+
+    cfl_growth_factor_ = Number(1.02);
+    add_parameter("cfl growth factor",
+                  cfl_growth_factor_,
+                  "Adaptive control: maximal factor by which the CFL number "
+                  "is increased after a successful time step");
+
+    cfl_reduction_factor_ = Number(0.8);
+    add_parameter("cfl reduction factor",
+                  cfl_reduction_factor_,
+                  "Adaptive control: factor by which the CFL number is "
+                  "reduced when a time step has to be restarted");
+
+    cfl_target_restart_rate_ = Number(0.01);
+    add_parameter("cfl target restart rate",
+                  cfl_target_restart_rate_,
+                  "Adaptive control: the CFL number is only increased while "
+                  "the recent fraction of restarted time steps is below "
+                  "this value");
+
+    embedded_error_tolerance_ = Number(0.);
+    add_parameter(
+        "embedded error tolerance",
+        embedded_error_tolerance_,
+        "If set to a positive value the erk 33, erk 43, and erk 54 schemes "
+        "estimate the local error of every time step with an embedded "
+        "lower-order solution formed from the stage vectors, and the CFL "
+        "number of the next step is chosen such that the L2 norm of the "
+        "local error, measured componentwise relative to the nodal state, "
+        "stays below this tolerance. Set to 0 to disable.");
+
+    embedded_cfl_max_ = Number(1.0);
+    add_parameter(
+        "embedded cfl max",
+        embedded_cfl_max_,
+        "Largest CFL number the embedded error control may select. This "
+        "value may exceed \"cfl max\" (which then only applies to the "
+        "first step). With the adaptive control recovery strategy the "
+        "CFL number is instead bounded by the adaptively chosen value");
 
     if (ParabolicSystem::is_identity)
       time_stepping_scheme_ = TimeSteppingScheme::erk_33;
@@ -66,8 +122,9 @@ namespace ryujin
                   time_stepping_scheme_,
                   "Time stepping scheme: ssprk 22, ssprk 33, erk 11, erk 22, "
                   "erk 33, erk 43, erk "
-                  "54, strang ssprk 33 cn, strang erk 33 cn, strang erk 43 cn, "
-                  "imex 11, imex 22, imex 33");
+                  "54, ssprk 43 ls, erk 33 ls, erk 54 ls, strang ssprk 33 cn, "
+                  "strang erk 33 cn, strang erk 43 cn, imex 11, imex 22, "
+                  "imex 33");
   }
 
 
@@ -80,6 +137,20 @@ namespace ryujin
 
     /* Resize temporary storage to appropriate sizes: */
 
+    /*
+     * The 2N-storage schemes work in place on the state vector unless
+     * restarts are possible, in which case the old state has to be kept:
+     */
+    const bool low_storage_in_place =
+        cfl_recovery_strategy_ == CFLRecoveryStrategy::none;
+
+    hyperbolic_module_->prepare_first_stage_reuse(!low_storage_in_place);
+
+    /* Number of temporary state vectors of the corresponding erk scheme: */
+    unsigned int n_standard_temporaries = 0;
+
+    increment_.reinit(std::size_t(0));
+
     switch (time_stepping_scheme_) {
     case TimeSteppingScheme::ssprk_22:
       temp_.resize(2);
@@ -90,7 +161,8 @@ namespace ryujin
       efficiency_ = 1.;
       break;
     case TimeSteppingScheme::erk_11:
-      temp_.resize(1);
+      /* Multirate: substep result, visible state, and increments: */
+      temp_.resize(hyperbolic_module_->n_rate_levels() == 0 ? 1 : 3);
       efficiency_ = 1.;
       break;
     case TimeSteppingScheme::erk_22:
@@ -109,6 +181,22 @@ namespace ryujin
       temp_.resize(5);
       efficiency_ = 5.;
       break;
+    case TimeSteppingScheme::ssprk_43_ls:
+      temp_.resize(2);
+      efficiency_ = 2.;
+      break;
+    case TimeSteppingScheme::erk_33_ls:
+      temp_.resize(low_storage_in_place ? 1 : 2);
+      /* 1 / max_k b_k, see step_low_storage_2n(): */
+      efficiency_ = 16. / 15.;
+      n_standard_temporaries = 3;
+      break;
+    case TimeSteppingScheme::erk_54_ls:
+      temp_.resize(low_storage_in_place ? 1 : 2);
+      /* 1 / max_k b_k, see step_low_storage_2n(): */
+      efficiency_ = 4481467310338. / 3134564353537.;
+      n_standard_temporaries = 5;
+      break;
     case TimeSteppingScheme::strang_ssprk_33_cn:
       temp_.resize(3);
       efficiency_ = 2.;
@@ -141,6 +229,31 @@ namespace ryujin
       Vectors::reinit_state_vector<Description>(it, *offline_data_);
     }
 
+    if (n_standard_temporaries != 0) {
+      increment_.reinit(offline_data_->hyperbolic_vector_partitioner());
+      increment_.first_touch(offline_data_->n_locally_internal());
+    }
+
+    /* Record the memory footprint of all temporaries: */
+
+    const auto state_vector_memory = [](const StateVector &state_vector) {
+      const auto &[U, precomputed, V] = state_vector;
+      return U.memory_consumption() + precomputed.memory_consumption() +
+             V.memory_consumption();
+    };
+
+    temporary_memory_ = increment_.memory_consumption();
+    for (const auto &it : temp_)
+      temporary_memory_ += state_vector_memory(it);
+
+    saved_memory_ = 0;
+    if (n_standard_temporaries != 0) {
+      const auto standard_memory =
+          n_standard_temporaries * state_vector_memory(temp_.front());
+      if (standard_memory > temporary_memory_)
+        saved_memory_ = standard_memory - temporary_memory_;
+    }
+
     /* Reset CFL to canonical starting value: */
 
     AssertThrow(cfl_min_ > 0., ExcMessage("cfl min must be a positive value"));
@@ -149,6 +262,36 @@ namespace ryujin
 
     hyperbolic_module_->cfl(cfl_max_);
 
+    /* Adaptive control starts from the safe end of the interval: */
+
+    AssertThrow(cfl_growth_factor_ >= 1. && cfl_reduction_factor_ > 0. &&
+                    cfl_reduction_factor_ < 1.,
+                ExcMessage("cfl growth factor must be at least 1 and cfl "
+                           "reduction factor must be in (0, 1)"));
+
+    adaptive_cfl_ = cfl_min_;
+    restart_rate_ = Number(0.);
+
+    /* Embedded error control starts from the regular CFL number: */
+
+    embedded_control_ =
+        embedded_error_tolerance_ > Number(0.) &&
+        (time_stepping_scheme_ == TimeSteppingScheme::erk_33 ||
+         time_stepping_scheme_ == TimeSteppingScheme::erk_43 ||
+         time_stepping_scheme_ == TimeSteppingScheme::erk_54);
+
+    AssertThrow(!embedded_control_ || embedded_cfl_max_ >= cfl_min_,
+                ExcMessage("embedded cfl max must be greater than or equal "
+                           "to cfl min"));
+
+    embedded_cfl_ = cfl_max_;
+    embedded_error_ = Number(0.);
+
+    AssertThrow(hyperbolic_module_->n_rate_levels() == 0 ||
+                    time_stepping_scheme_ == TimeSteppingScheme::erk_11,
+                ExcMessage("Multirate time stepping (multirate levels > 0) "
+                           "requires the »erk 11« time stepping scheme"));
+
     const auto check_whether_timestepping_makes_sense = [&]() {
       /*
        * Make sure the user selects an appropriate time-stepping scheme.
@@ -167,7 +310,13 @@ namespace ryujin
         [[fallthrough]];
       case TimeSteppingScheme::erk_43:
         [[fallthrough]];
-      case TimeSteppingScheme::erk_54: {
+      case TimeSteppingScheme::erk_54:
+        [[fallthrough]];
+      case TimeSteppingScheme::ssprk_43_ls:
+        [[fallthrough]];
+      case TimeSteppingScheme::erk_33_ls:
+        [[fallthrough]];
+      case TimeSteppingScheme::erk_54_ls: {
         AssertThrow(
             ParabolicSystem::is_identity,
             dealii::ExcMessage(
@@ -230,6 +379,12 @@ namespace ryujin
         return step_erk_43(state_vector, t, tau_max);
       case TimeSteppingScheme::erk_54:
         return step_erk_54(state_vector, t, tau_max);
+      case TimeSteppingScheme::ssprk_43_ls:
+        return step_ssprk_43_ls(state_vector, t, tau_max);
+      case TimeSteppingScheme::erk_33_ls:
+        return step_erk_33_ls(state_vector, t, tau_max);
+      case TimeSteppingScheme::erk_54_ls:
+        return step_erk_54_ls(state_vector, t, tau_max);
       case TimeSteppingScheme::strang_ssprk_33_cn:
         return step_strang_ssprk_33_cn(state_vector, t, tau_max);
       case TimeSteppingScheme::strang_erk_33_cn:
@@ -255,19 +410,114 @@ namespace ryujin
       hyperbolic_module_->cfl(cfl_max_);
     }
 
+    /*
+     * Adaptive control: Once we are at "cfl min" we can only warn. We
+     * also ask the HyperbolicModule whether the step would have been
+     * admissible with a CFL number increased by the growth factor:
+     */
+    if (cfl_recovery_strategy_ == CFLRecoveryStrategy::adaptive_control) {
+      const auto strategy = adaptive_cfl_ > cfl_min_
+                                ? IDViolationStrategy::raise_exception
+                                : IDViolationStrategy::warn;
+      hyperbolic_module_->id_violation_strategy_ = strategy;
+      parabolic_module_->id_violation_strategy_ = strategy;
+      hyperbolic_module_->cfl(adaptive_cfl_);
+      hyperbolic_module_->limiter_slack_probe(cfl_growth_factor_);
+    }
+
+    /*
+     * Embedded error control: Start with the CFL number proposed by the
+     * step-size controller (possibly larger than "cfl max"). A restart
+     * falls back to the recovery strategy.
+     */
+    if (embedded_control_) {
+      if (cfl_recovery_strategy_ == CFLRecoveryStrategy::adaptive_control)
+        hyperbolic_module_->cfl(std::min(adaptive_cfl_, embedded_cfl_));
+      else
+        hyperbolic_module_->cfl(embedded_cfl_);
+    }
+
+    /* Exponential moving average of the restart rate: */
+    constexpr Number restart_rate_weight = 0.05;
+
+    const auto accept = [&](const Number tau) {
+      const Number cfl = hyperbolic_module_->cfl();
+      n_accepted_steps_++;
+      cfl_sum_ += cfl;
+      cfl_min_used_ = std::min(cfl_min_used_, cfl);
+      cfl_max_used_ = std::max(cfl_max_used_, cfl);
+
+      if (cfl_recovery_strategy_ == CFLRecoveryStrategy::adaptive_control) {
+        restart_rate_ *= Number(1.) - restart_rate_weight;
+
+        if (!hyperbolic_module_->limiter_slack_exhausted() &&
+            restart_rate_ < cfl_target_restart_rate_) {
+          const Number damping =
+              Number(1.) - restart_rate_ / cfl_target_restart_rate_;
+          const Number growth =
+              Number(1.) + damping * (cfl_growth_factor_ - Number(1.));
+          adaptive_cfl_ = std::min(cfl_max_, growth * adaptive_cfl_);
+        }
+
+        hyperbolic_module_->limiter_slack_probe(Number(1.));
+      }
+
+      /*
+       * Embedded error control: All embedded solutions are of second
+       * order, so the local error estimate is of order 3 and the
+       * admissible time step size (and thus the CFL number, assuming that
+       * the CFL time step size varies slowly) scales with err^{-1/3}. We
+       * use a safety factor and limit the change per step:
+       */
+      if (embedded_control_) {
+        constexpr Number order = 3.;
+        const Number error =
+            std::max(embedded_error_, std::numeric_limits<Number>::min());
+        const Number factor =
+            std::clamp(Number(0.9) * std::pow(error, Number(-1.) / order),
+                       Number(0.5),
+                       Number(1.2));
+        embedded_cfl_ =
+            std::clamp(factor * cfl, cfl_min_, embedded_cfl_max_);
+      }
+
+      return tau;
+    };
+
     try {
-      return single_step();
+      return accept(single_step());
 
     } catch (Restart) {
 
       AssertThrow(cfl_recovery_strategy_ != CFLRecoveryStrategy::none,
                   dealii::ExcInternalError());
 
+      n_restarted_steps_++;
+
+      /* The first stage only has to redo the tau-dependent work: */
+      hyperbolic_module_->request_first_stage_reuse();
+
       if (cfl_recovery_strategy_ == CFLRecoveryStrategy::bang_bang_control) {
         hyperbolic_module_->id_violation_strategy_ = IDViolationStrategy::warn;
         parabolic_module_->id_violation_strategy_ = IDViolationStrategy::warn;
         hyperbolic_module_->cfl(cfl_min_);
-        return single_step();
+        return accept(single_step());
+      }
+
+      if (cfl_recovery_strategy_ == CFLRecoveryStrategy::adaptive_control) {
+        restart_rate_ = (Number(1.) - restart_rate_weight) * restart_rate_ +
+                        restart_rate_weight;
+        /*
+         * Reduce the CFL number that was actually used (which might have
+         * been chosen by the embedded error control) and make sure that
+         * the embedded error control does not immediately propose a
+         * larger value again:
+         */
+        adaptive_cfl_ = std::max(
+            cfl_min_,
+            cfl_reduction_factor_ * std::min(adaptive_cfl_, embedded_cfl_));
+        embedded_cfl_ = std::min(embedded_cfl_, adaptive_cfl_);
+        return step(state_vector, t, t_final);
       }
 
       __builtin_unreachable();
@@ -275,6 +525,29 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeIntegrator<Description, dim, Number>::print_cfl_statistics(
+      std::ostream &output) const
+  {
+    if (n_accepted_steps_ == 0)
+      return;
+
+    output << "        [ CFL min/avg/max: " << std::setprecision(2)
+           << std::fixed << cfl_min_used_ << "/"
+           << cfl_sum_ / n_accepted_steps_ << "/" << cfl_max_used_
+           << ", restarted steps: " << n_restarted_steps_ << " ("
+           << std::setprecision(1)
+           << 100. * n_restarted_steps_ /
+                  (n_accepted_steps_ + n_restarted_steps_)
+           << "%), reused first stages: "
+           << hyperbolic_module_->n_reused_first_stages();
+    if (embedded_control_)
+      output << ", embedded error: " << std::setprecision(2)
+             << std::scientific << embedded_error_ * embedded_error_tolerance_;
+    output << " ]" << std::endl;
+  }
+
+
   template <typename Description, int dim, typename Number>
   Number TimeIntegrator<Description, dim, Number>::step_ssprk_22(
       StateVector &state_vector, Number t, Number tau_max)
@@ -287,7 +560,7 @@ namespace ryujin
         state_vector, {}, {}, temp_[0], Number(0.), tau_max);
 
     /* Step 2: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
 
     /* Step 2: convex combination: T1 = 1/2 U_old + 1/2 T1 at time t + tau */
@@ -310,7 +583,7 @@ namespace ryujin
         state_vector, {}, {}, temp_[0], Number(0.), tau_max);
 
     /* Step 2: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
 
     /* Step 2: convex combination T1 = 3/4 U_old + 1/4 T1 at time t + 0.5*tau */
@@ -336,6 +609,9 @@ namespace ryujin
     std::cout << "TimeIntegrator<dim, Number>::step_erk_11()" << std::endl;
 #endif
 
+    if (hyperbolic_module_->n_rate_levels() != 0)
+      return step_erk_11_multirate(state_vector, t, tau_max);
+
     /* Step 1: T0 <- {U_old, 1} at time t -> t + tau */
     hyperbolic_module_->prepare_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
@@ -346,6 +622,43 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_erk_11_multirate(
+      StateVector &state_vector, Number t, Number tau_max)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_erk_11_multirate()"
+              << std::endl;
+#endif
+
+    /*
+     * Perform a cycle of 2^L forward Euler substeps. The first substep
+     * assigns rate levels and selects tau; the state vector is only
+     * updated at the end of the cycle so that a restart can simply redo
+     * the whole cycle.
+     */
+
+    const unsigned int n_substeps = 1u << hyperbolic_module_->n_rate_levels();
+
+    auto &visible = temp_[1];
+    auto &increment = temp_[2];
+    std::get<0>(visible) = std::get<0>(state_vector);
+    std::get<0>(increment) = Number(0.);
+
+    Number tau = Number(0.);
+    for (unsigned int k = 0; k < n_substeps; ++k) {
+      hyperbolic_module_->multirate_substep(k);
+      hyperbolic_module_->prepare_state_vector(visible, t + k * tau);
+      tau = hyperbolic_module_->template step<0>(
+          visible, {}, {}, temp_[0], tau, tau_max / n_substeps);
+      hyperbolic_module_->multirate_update(visible, increment, temp_[0]);
+    }
+
+    state_vector.swap(visible);
+    return n_substeps * tau;
+  }
+
+
   template <typename Description, int dim, typename Number>
   Number TimeIntegrator<Description, dim, Number>::step_erk_22(
       StateVector &state_vector, Number t, Number tau_max)
@@ -360,7 +673,7 @@ namespace ryujin
         state_vector, {}, {}, temp_[0], Number(.0), tau_max / 2.);
 
     /* Step 2: T1 <- {T0, 2} and {U_old, -1} at time t + tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
@@ -383,7 +696,7 @@ namespace ryujin
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 3.);
 
     /* Step 2: T1 <- {T0, 2} and {U_old, -1} at time t + 1*tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
@@ -391,13 +704,25 @@ namespace ryujin
      * Step 3: T2 <- {T1, 9/4} and {T0, -2} and {U_old, 3/4}
      * at time t + 2*tau -> t + 3*tau
      */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<2>(temp_[1],
                                          {{state_vector, temp_[0]}},
                                          {{Number(0.75), Number(-2.)}},
                                          temp_[2],
                                          tau);
 
+    /*
+     * Embedded error estimate: In terms of stage derivatives K_i the
+     * scheme is Heun's third-order method with b = (1/4, 0, 3/4) and c =
+     * (0, 1/3, 2/3). We use the second-order embedded weights b^ = (0,
+     * 1/2, 1/2) and express dt (b - b^) K with the stage states.
+     */
+    if (embedded_control_)
+      embedded_error_ = embedded_error<3>(
+          state_vector,
+          {{temp_[0], temp_[1], temp_[2]}},
+          {{Number(1. / 2.), Number(-3. / 4.), Number(1. / 3.)}});
+
     state_vector.swap(temp_[2]);
     return 3. * tau;
   }
@@ -417,12 +742,12 @@ namespace ryujin
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 4.);
 
     /* Step 2: T1 <- {T0, 2} and {U_old, -1} at time t + 1*tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
     /* Step 3: T2 <- {T1, 2} and {T0, -1} at time t + 2*tau -> t + 3*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[1], {{temp_[0]}}, {{Number(-1.)}}, temp_[2], tau);
 
@@ -430,13 +755,26 @@ namespace ryujin
      * Step 4: T3 <- {T2, 8/3} and {T1,-10/3} and {T0, 5/3}
      * at time t + 3*tau -> t + 4*tau
      */
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 3.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[2], t + 3.0 * tau);
     hyperbolic_module_->template step<2>(temp_[2],
                                          {{temp_[0], temp_[1]}},
                                          {{Number(5. / 3.), Number(-10. / 3.)}},
                                          temp_[3],
                                          tau);
 
+    /*
+     * Embedded error estimate: In terms of stage derivatives K_i the
+     * scheme has b = (0, 2/3, -1/3, 2/3) and c = (0, 1/4, 1/2, 3/4), and
+     * the third stage is the midpoint of the second-order midpoint rule
+     * with b^ = (0, 0, 1, 0). The difference simplifies to T3 - 2 T2 +
+     * T1.
+     */
+    if (embedded_control_)
+      embedded_error_ = embedded_error<3>(
+          state_vector,
+          {{temp_[1], temp_[2], temp_[3]}},
+          {{Number(1.), Number(-2.), Number(1.)}});
+
     state_vector.swap(temp_[3]);
     return 4. * tau;
   }
@@ -473,12 +811,12 @@ namespace ryujin
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 5.);
 
     /* Step 2: at time t + 1*tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{(a_31 - a_21) / c}}, temp_[1], tau);
 
     /* Step 3: at time t + 2*tau -> t + 3*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<2>(
         temp_[1],
         {{state_vector, temp_[0]}},
@@ -487,7 +825,7 @@ namespace ryujin
         tau);
 
     /* Step 4: at time t + 3*tau -> t + 4*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 3.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[2], t + 3.0 * tau);
     hyperbolic_module_->template step<3>(
         temp_[2],
         {{state_vector, temp_[0], temp_[1]}},
@@ -496,7 +834,7 @@ namespace ryujin
         tau);
 
     /* Step 5: at time t + 4*tau -> t + 5*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[3], t + 4.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[3], t + 4.0 * tau);
     hyperbolic_module_->template step<4>(
         temp_[3],
         {{state_vector, temp_[0], temp_[1], temp_[2]}},
@@ -507,11 +845,263 @@ namespace ryujin
         temp_[4],
         tau);
 
+    /*
+     * Embedded error estimate: The (unique) third-order embedded weights
+     * that do not use the last stage derivative lead to weights of about
+     * 110 and -73 for the first two stage states (because a_43 is small)
+     * and would amplify the limiter corrections of these stages. We
+     * instead use the second-order embedded weights
+     *   b^ = (0.97132155483855120, -0.23032993853286510,
+     *         -1.9533047874499236, 2.2123131711442374, 0),
+     * for which dt (b - b^) K only involves the last three stage states.
+     */
+    if (embedded_control_)
+      embedded_error_ = embedded_error<3>(
+          state_vector,
+          {{temp_[2], temp_[3], temp_[4]}},
+          {{Number(1.6661857981703145),
+            Number(-2.4996393486277360),
+            Number(1.)}});
+
     state_vector.swap(temp_[4]);
     return 5. * tau;
   }
 
 
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_ssprk_43_ls(
+      StateVector &state_vector, Number t, Number tau_max)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_ssprk_43_ls()" << std::endl;
+#endif
+
+    /*
+     * SSP-RK(4,3), see @cite Ketcheson2008, in Shu-Osher form
+     * with a forward Euler step size tau = dt / 2.
+     */
+
+    /* Step 1: T0 = U_old + tau * L(U_old) at time t -> t + tau */
+    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    Number tau = hyperbolic_module_->template step<0>(
+        state_vector, {}, {}, temp_[0], Number(0.), tau_max / 2.);
+
+    /* Step 2: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+
+    /* Step 3: T0 = T1 + tau L(T1) at time t + 2*tau -> t + 3*tau */
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[1], {}, {}, temp_[0], tau);
+
+    /* Step 3: convex combination T0 = 2/3 U_old + 1/3 T0 at time t + tau */
+    sadd(temp_[0], Number(1.0 / 3.0), Number(2.0 / 3.0), state_vector);
+
+    /* Step 4: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
+    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+
+    state_vector.swap(temp_[1]);
+    return 2. * tau;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_erk_33_ls(
+      StateVector &state_vector, Number t, Number tau_max)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_erk_33_ls()" << std::endl;
+#endif
+
+    /* Third-order 2N-storage scheme, see @cite Williamson1980: */
+    return step_low_storage_2n<3>(state_vector,
+                                  t,
+                                  tau_max,
+                                  {{0., -5. / 9., -153. / 128.}},
+                                  {{1. / 3., 15. / 16., 8. / 15.}},
+                                  {{0., 1. / 3., 3. / 4.}});
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_erk_54_ls(
+      StateVector &state_vector, Number t, Number tau_max)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_erk_54_ls()" << std::endl;
+#endif
+
+    /* RK4(3)5[2N] scheme, see @cite CarpenterKennedy1994: */
+    return step_low_storage_2n<5>(
+        state_vector,
+        t,
+        tau_max,
+        {{0.,
+          -567301805773. / 1357537059087.,
+          -2404267990393. / 2016746695238.,
+          -3550918686646. / 2091501179385.,
+          -1275806237668. / 842570457699.}},
+        {{1432997174477. / 9575080441755.,
+          5161836677717. / 13612068292357.,
+          1720146321549. / 2090206949498.,
+          3134564353537. / 4481467310338.,
+          2277821191437. / 14882151754819.}},
+        {{0.,
+          1432997174477. / 9575080441755.,
+          2526269341429. / 6820363962896.,
+          2006345519317. / 3224310063776.,
+          2802321613138. / 2924317926251.}});
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  template <std::size_t n_stages>
+  Number TimeIntegrator<Description, dim, Number>::embedded_error(
+      const StateVector &old_state_vector,
+      std::array<std::reference_wrapper<const StateVector>, n_stages>
+          stage_state_vectors,
+      const std::array<Number, n_stages> &weights) const
+  {
+    using state_type = typename View::state_type;
+    constexpr unsigned int problem_dimension = View::problem_dimension;
+
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+    const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
+    const double measure_of_omega = offline_data_->measure_of_omega();
+    const auto &U = std::get<0>(old_state_vector);
+
+    /*
+     * Every component of the error is measured relative to the nodal
+     * value of that component. In order to not divide by (almost) zero,
+     * e.g. for a vanishing momentum, the nodal value is bounded from
+     * below by a fraction of the root mean square of the component:
+     */
+    constexpr double floor_fraction = 0.1;
+
+    std::vector<double> floors(problem_dimension, 0.);
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    std::vector<double> thread_floors(problem_dimension, 0.);
+
+    RYUJIN_OMP_FOR_NOWAIT
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      const auto m_i = lumped_mass_matrix.local_element(i);
+      const auto U_i = U.get_tensor(i);
+      for (unsigned int c = 0; c < problem_dimension; ++c)
+        thread_floors[c] += m_i * U_i[c] * U_i[c];
+    }
+
+    RYUJIN_OMP_CRITICAL
+    {
+      for (unsigned int c = 0; c < problem_dimension; ++c)
+        floors[c] += thread_floors[c];
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+
+    floors = Utilities::MPI::sum(floors, mpi_communicator_);
+    for (auto &it : floors)
+      it = floor_fraction * floor_fraction * it / measure_of_omega +
+           std::numeric_limits<double>::min();
+
+    /* Squared (lumped mass) L2 norm of the scaled error: */
+    double error = 0.;
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    double thread_error = 0.;
+
+    RYUJIN_OMP_FOR_NOWAIT
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      const auto m_i = lumped_mass_matrix.local_element(i);
+      const auto U_i = U.get_tensor(i);
+
+      state_type E_i;
+      for (unsigned int k = 0; k < n_stages; ++k) {
+        const auto &T_k = std::get<0>(stage_state_vectors[k].get());
+        E_i += weights[k] * (T_k.get_tensor(i) - U_i);
+      }
+
+      for (unsigned int c = 0; c < problem_dimension; ++c)
+        thread_error += m_i * E_i[c] * E_i[c] / (U_i[c] * U_i[c] + floors[c]);
+    }
+
+    RYUJIN_OMP_CRITICAL
+    {
+      error += thread_error;
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+
+    error = Utilities::MPI::sum(error, mpi_communicator_);
+
+    return Number(std::sqrt(error / (problem_dimension * measure_of_omega)) /
+                  embedded_error_tolerance_);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  template <std::size_t n_stages>
+  Number TimeIntegrator<Description, dim, Number>::step_low_storage_2n(
+      StateVector &state_vector,
+      Number t,
+      Number tau_max,
+      const std::array<Number, n_stages> &a,
+      const std::array<Number, n_stages> &b,
+      const std::array<Number, n_stages> &c)
+  {
+    /*
+     * Every stage performs a forward Euler step T0 <- U + tau L(U) with
+     * the same tau (selected in the first stage) and we recover the stage
+     * derivative dt L(U) = ratio * (T0 - U). We only need the stage
+     * state U, the scratch state T0, and the (hyperbolic) increment dU.
+     * If a restart is possible we work on a copy of the old state.
+     *
+     * The combination U <- U + b_k dU is not limited. We therefore choose
+     * dt = tau / max_k b_k, so that at least the contribution
+     * b_k dt L(U) = b_k ratio (T0 - U) of the current stage is a convex
+     * combination of U and T0. The contribution a_k dU of the previous
+     * stages remains unlimited, so the scheme is not invariant domain
+     * preserving.
+     */
+
+    const bool in_place = temp_.size() == 1;
+    auto &U = in_place ? state_vector : temp_[1];
+    if (!in_place)
+      std::get<0>(U) = std::get<0>(state_vector);
+
+    auto &U_k = std::get<0>(U);
+    const auto &T_k = std::get<0>(temp_[0]);
+
+    const Number ratio = /* dt / tau */
+        Number(1.) / *std::max_element(std::begin(b), std::end(b));
+
+    Number tau = Number(0.);
+    for (unsigned int k = 0; k < n_stages; ++k) {
+      hyperbolic_module_->prepare_state_vector(U, t + c[k] * ratio * tau);
+      if (k == 0)
+        tau = hyperbolic_module_->template step<0>(
+            U, {}, {}, temp_[0], Number(0.), tau_max / ratio);
+      else
+        hyperbolic_module_->template step<0>(U, {}, {}, temp_[0], tau);
+
+      /* dU <- a_k dU + ratio * (T0 - U), U <- U + b_k dU */
+      if (k == 0)
+        increment_.equ(ratio, T_k);
+      else
+        increment_.sadd(a[k], ratio, T_k);
+      increment_.add(-ratio, U_k);
+      U_k.add(b[k], increment_);
+    }
+
+    if (!in_place)
+      state_vector.swap(U);
+    return ratio * tau;
+  }
+
+
   template <typename Description, int dim, typename Number>
   Number TimeIntegrator<Description, dim, Number>::step_strang_ssprk_33_cn(
       StateVector &state_vector, Number t, Number tau_max)
@@ -529,7 +1119,7 @@ namespace ryujin
     Number tau = hyperbolic_module_->template step<0>(
         /*!*/ state_vector, {}, {}, temp_[0], Number(0.0), tau_max / 2.);
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
     sadd(temp_[1], Number(1.0 / 4.0), Number(3.0 / 4.0), /*!*/ state_vector);
 
@@ -547,7 +1137,7 @@ namespace ryujin
     hyperbolic_module_->prepare_state_vector(/*!*/ temp_[2], t + 1.0 * tau);
     hyperbolic_module_->template step<0>(/*!*/ temp_[2], {}, {}, temp_[0], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 2.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 2.0 * tau);
     hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
     sadd(temp_[1], Number(1.0 / 4.0), Number(3.0 / 4.0), /*!*/ temp_[2]);
 
@@ -577,11 +1167,11 @@ namespace ryujin
     Number tau = hyperbolic_module_->template step<0>(
         /*!*/ state_vector, {}, {}, temp_[0], Number(0.), tau_max / 6.);
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{/*!*/ state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<2>(temp_[1],
                                          {{/*!*/ state_vector, temp_[0]}},
                                          {{Number(0.75), Number(-2.)}},
@@ -600,11 +1190,11 @@ namespace ryujin
     hyperbolic_module_->template step<0>(
         /*!*/ temp_[3], {}, {}, temp_[0], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 4.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 4.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{/*!*/ temp_[3]}}, {{Number(-1.)}}, temp_[1], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 5.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 5.0 * tau);
     hyperbolic_module_->template step<2>(temp_[1],
                                          {{/*!*/ temp_[3], temp_[0]}},
                                          {{Number(0.75), Number(-2.)}},
@@ -633,15 +1223,15 @@ namespace ryujin
     Number tau = hyperbolic_module_->template step<0>(
         /*!*/ state_vector, {}, {}, temp_[0], Number(0.), tau_max / 8.);
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{/*!*/ state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[1], {{temp_[0]}}, {{Number(-1.)}}, temp_[2], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 3.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[2], t + 3.0 * tau);
     hyperbolic_module_->template step<2>(temp_[2],
                                          {{temp_[0], temp_[1]}},
                                          {{Number(5. / 3.), Number(-10. / 3.)}},
@@ -660,15 +1250,15 @@ namespace ryujin
     hyperbolic_module_->template step<0>(
         /*!*/ temp_[2], {}, {}, temp_[0], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 5.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[0], t + 5.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{/*!*/ temp_[2]}}, {{Number(-1.)}}, temp_[1], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 6.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[1], t + 6.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[1], {{temp_[0]}}, {{Number(-1.)}}, temp_[2], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 7.0 * tau);
+    hyperbolic_module_->prepare_stage_state_vector(temp_[2], t + 7.0 * tau);
     hyperbolic_module_->template step<2>(temp_[2],
                                          {{temp_[0], temp_[1]}},
                                          {{Number(5. / 3.), Number(-10. / 3.)}},
@@ -254,6 +254,7 @@ namespace ryujin
       vtu_output_.prepare();
       quantities_.prepare(base_name_);
       print_mpi_partition(logfile_);
+      hyperbolic_module_.print_page_placement(logfile_);
     };
 
     {
@@ -1001,6 +1002,42 @@ namespace ryujin
     Utilities::MPI::MinMaxAvg data =
         Utilities::MPI::min_max_avg(stats.VmRSS / 1024., mpi_communicator_);
 
+    Utilities::MPI::MinMaxAvg peak_data =
+        Utilities::MPI::min_max_avg(stats.VmHWM / 1024., mpi_communicator_);
+
+    /*
+     * Memory footprint of the temporary vectors of the time integrator,
+     * and the memory saved by a low-storage time-stepping scheme:
+     */
+    Utilities::MPI::MinMaxAvg temporary_data = Utilities::MPI::min_max_avg(
+        time_integrator_.temporary_memory() / 1024. / 1024., mpi_communicator_);
+    Utilities::MPI::MinMaxAvg saved_data = Utilities::MPI::min_max_avg(
+        time_integrator_.saved_memory() / 1024. / 1024., mpi_communicator_);
+
+    /*
+     * Memory footprint of the p_ij matrix. This memory is saved if the
+     * HyperbolicModule recomputes p_ij on the fly:
+     */
+    const auto n_nonzero_elements =
+        offline_data_.sparsity_pattern_simd().n_nonzero_elements();
+    Utilities::MPI::MinMaxAvg pij_data = Utilities::MPI::min_max_avg(
+        n_nonzero_elements * problem_dimension * sizeof(Number) / 1024. / 1024.,
+        mpi_communicator_);
+
+    /*
+     * Memory footprint (and thus memory traffic per sweep) of the
+     * geometric offline matrices: mass matrix and c_ij matrix (and the
+     * inverse mass and incidence matrix for a discontinuous ansatz):
+     */
+    using MatrixNumber = typename OfflineData<dim, Number>::MatrixNumber;
+    const unsigned int n_matrix_components =
+        1 + dim +
+        (offline_data_.discretization().have_discontinuous_ansatz() ? 2 : 0);
+    Utilities::MPI::MinMaxAvg matrix_data = Utilities::MPI::min_max_avg(
+        n_nonzero_elements * n_matrix_components * sizeof(MatrixNumber) /
+            1024. / 1024.,
+        mpi_communicator_);
+
     if (mpi_rank_ != 0)
       return;
 
@@ -1015,6 +1052,26 @@ namespace ryujin
            << std::setw(8) << data.max                        //
            << " [p" << std::setw(n) << data.max_index << "]"; //
 
+    output << "\n             [p_ij "
+           << (hyperbolic_module_.recompute_pij() ? "recomputed, saved "
+                                                  : "stored, using ")
+           << pij_data.avg << " MiB/rank on average]";
+
+    output << "\n             [offline matrices ("
+           << (std::is_same_v<MatrixNumber, float> ? "single" : "double")
+           << " precision) using " << matrix_data.avg
+           << " MiB/rank on average]";
+
+    output << "\n             [time integrator temporaries using "
+           << temporary_data.avg << " MiB/rank on average";
+    if (saved_data.max > 0.)
+      output << ", low-storage scheme saved " << saved_data.avg
+             << " MiB/rank on average";
+    output << "]";
+
+    output << "\n             [peak: " << peak_data.max << " MiB [p"
+           << std::setw(n) << peak_data.max_index << "]]";
+
     stream << output.str() << std::endl;
   }
 
@@ -1213,6 +1270,10 @@ namespace ryujin
            << std::setprecision(2) << std::fixed << cycles_per_second
            << " cycles/s)" << std::endl;
 
+    output << "        [ p_ij "
+           << (hyperbolic_module_.recompute_pij() ? "recomputed" : "stored")
+           << " ]" << std::endl;
+
     const auto &scheme = time_integrator_.time_stepping_scheme();
     output << "        [ "
            << Patterns::Tools::Convert<TimeSteppingScheme>::to_string(scheme)
@@ -1228,9 +1289,15 @@ namespace ryujin
            << std::setprecision(0) << std::fixed << parabolic_module_.n_warnings()
            << " warn) ]" << std::endl;
 
+    time_integrator_.print_cfl_statistics(output);
+
     if constexpr (!ParabolicSystem::is_identity)
       parabolic_module_.print_solver_statistics(output);
 
+    hyperbolic_module_.print_thread_statistics(output);
+    hyperbolic_module_.print_communication_statistics(output);
+    hyperbolic_module_.print_multirate_statistics(output);
+
     output << "        [ dt = "
            << std::scientific << std::setprecision(2) << delta_time
            << " ( "
@@ -0,0 +1,140 @@
+#include <multicomponent_vector.h>
+#include <persistent_requests.h>
+
+#include <deal.II/base/index_set.h>
+
+/*
+ * Compare the fused ghost exchange of PersistentGhostExchange for a
+ * scalar vector and a vector with three components against the expected
+ * ghost values. Every rank owns 100 indices and ghosts a couple of
+ * (non-contiguous) indices of all other ranks. The exchange is repeated
+ * with new values to verify that the persistent requests are reused
+ * correctly. Finally, the reduced precision payloads are tested.
+ */
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  const auto mpi_rank =
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const auto n_mpi_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  constexpr unsigned int n_owned = 100;
+  const unsigned int n_global = n_owned * n_mpi_processes;
+  const unsigned int first = mpi_rank * n_owned;
+
+  dealii::IndexSet locally_owned(n_global);
+  locally_owned.add_range(first, first + n_owned);
+
+  dealii::IndexSet ghosts(n_global);
+  for (unsigned int p = 0; p < n_mpi_processes; ++p) {
+    if (p == mpi_rank)
+      continue;
+    for (const unsigned int k : {0u, 1u, 2u, 7u, 50u, 51u, 98u, 99u})
+      if ((k + mpi_rank) % 3 != 0)
+        ghosts.add_index(p * n_owned + k);
+  }
+
+  const auto scalar_partitioner =
+      std::make_shared<const dealii::Utilities::MPI::Partitioner>(
+          locally_owned, ghosts, MPI_COMM_WORLD);
+  const auto vector_partitioner =
+      ryujin::Vectors::create_vector_partitioner(scalar_partitioner, 3);
+
+  dealii::LinearAlgebra::distributed::Vector<double> a(scalar_partitioner);
+  ryujin::Vectors::MultiComponentVector<double, 3> b;
+  b.reinit(vector_partitioner);
+
+  ryujin::PersistentGhostExchange<double> ghost_exchange;
+
+  unsigned int n_errors = 0;
+
+  for (unsigned int round = 0; round < 3; ++round) {
+    const auto value = [&](const unsigned int global, const unsigned int d) {
+      return 1000. * round + 10. * global + d;
+    };
+
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      a.local_element(i) = value(first + i, 0);
+      for (unsigned int d = 0; d < 3; ++d)
+        b.local_element(3 * i + d) = value(first + i, d);
+    }
+
+    a.zero_out_ghost_values();
+    b.zero_out_ghost_values();
+
+    const unsigned int n_ghosts = scalar_partitioner->n_ghost_indices();
+    for (unsigned int i = n_owned; i < n_owned + n_ghosts; ++i) {
+      a.local_element(i) = -1.;
+      for (unsigned int d = 0; d < 3; ++d)
+        b.local_element(3 * i + d) = -1.;
+    }
+
+    if (round == 1) {
+      /* Exercise the single vector code path as well: */
+      ghost_exchange.update_ghost_values(a, 1);
+      ghost_exchange.update_ghost_values(b, 2);
+    } else {
+      ghost_exchange.start({&a, &b}, 3);
+      ghost_exchange.finish();
+    }
+
+    if (!a.has_ghost_elements() || !b.has_ghost_elements())
+      ++n_errors;
+
+    for (unsigned int i = n_owned; i < n_owned + n_ghosts; ++i) {
+      const auto global = scalar_partitioner->local_to_global(i);
+      if (a.local_element(i) != value(global, 0))
+        ++n_errors;
+      for (unsigned int d = 0; d < 3; ++d)
+        if (b.local_element(3 * i + d) != value(global, d))
+          ++n_errors;
+    }
+  }
+
+  /*
+   * Reduced precision payloads: Ghost values have to be rounded down and
+   * have to agree bitwise with the (overwritten) values of the owner,
+   * which we verify with a subsequent full precision exchange.
+   */
+
+  for (const auto precision : {ryujin::PayloadPrecision::single,
+                               ryujin::PayloadPrecision::fixed_point_16}) {
+    const auto value = [&](const unsigned int global) {
+      return (global + 0.3) / n_global;
+    };
+
+    for (unsigned int i = 0; i < n_owned; ++i)
+      a.local_element(i) = value(first + i);
+
+    ghost_exchange.start(a, 4, precision);
+    ghost_exchange.finish();
+
+    const unsigned int n_ghosts = scalar_partitioner->n_ghost_indices();
+    const double tolerance =
+        precision == ryujin::PayloadPrecision::single ? 1.e-7 : 1. / 65535.;
+
+    std::vector<double> rounded(n_ghosts);
+    for (unsigned int i = 0; i < n_ghosts; ++i) {
+      const auto global = scalar_partitioner->local_to_global(n_owned + i);
+      rounded[i] = a.local_element(n_owned + i);
+      if (rounded[i] > value(global) || value(global) - rounded[i] > tolerance)
+        ++n_errors;
+    }
+
+    ghost_exchange.update_ghost_values(a, 5);
+
+    for (unsigned int i = 0; i < n_ghosts; ++i)
+      if (a.local_element(n_owned + i) != rounded[i])
+        ++n_errors;
+  }
+
+  for (unsigned int p = 0; p < n_mpi_processes; ++p) {
+    if (p == mpi_rank)
+      std::cout << "Rank " << p << ": " << (n_errors == 0 ? "OK" : "FAILED")
+                << std::endl;
+    MPI_Barrier(MPI_COMM_WORLD);
+  }
+}
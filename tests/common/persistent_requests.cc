@@ -0,0 +1,214 @@
+#include <persistent_requests.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <set>
+
+/*
+ * MPI-only microbenchmark comparing a ghost exchange pattern with freshly
+ * posted MPI_Irecv()/MPI_Isend() requests against the same pattern with
+ * persistent requests (PersistentRequests, MPI_Startall()).
+ *
+ * Every rank exchanges a message of fixed size with up to six neighboring
+ * ranks (rank +- 1, 2, 3), mimicking the ghost exchanges of
+ * SparseMatrixSIMD::update_ghost_rows() for small subdomains. By default
+ * the program only verifies that both variants deliver identical data.
+ * Invoke with
+ *
+ *   mpirun -np <n> ./persistent_requests.<build> --benchmark
+ *
+ * to additionally print the average (maximum over all ranks) wall time
+ * per exchange for message sizes between 8 bytes and 512 KiB.
+ */
+
+namespace
+{
+  struct Pattern {
+    std::vector<int> neighbors;
+    unsigned int n_doubles;
+  };
+
+
+  /* Payload sent by rank @p rank in round @p round: */
+  double
+  payload(const int rank, const unsigned int round, const unsigned int k)
+  {
+    return 1000000. * rank + 1000. * round + k;
+  }
+
+
+  /* Check that all receive buffers hold the payload of round @p round: */
+  bool check(const Pattern &pattern,
+             const std::vector<double> &receive_buffer,
+             const unsigned int round)
+  {
+    bool ok = true;
+    for (unsigned int p = 0; p < pattern.neighbors.size(); ++p)
+      for (unsigned int k = 0; k < pattern.n_doubles; ++k)
+        ok &= receive_buffer[p * pattern.n_doubles + k] ==
+              payload(pattern.neighbors[p], round, k);
+    return ok;
+  }
+
+
+  /* Variant 1: fresh MPI_Irecv()/MPI_Isend() requests for every round */
+  double exchange_immediate(const Pattern &pattern,
+                            const unsigned int n_rounds,
+                            bool &ok)
+  {
+    const auto rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    const unsigned int n = pattern.n_doubles;
+    const auto n_neighbors = pattern.neighbors.size();
+
+    std::vector<double> send_buffer(n_neighbors * n);
+    std::vector<double> receive_buffer(n_neighbors * n);
+    std::vector<MPI_Request> requests(2 * n_neighbors);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double start = MPI_Wtime();
+
+    for (unsigned int round = 0; round < n_rounds; ++round) {
+      for (unsigned int p = 0; p < n_neighbors; ++p)
+        MPI_Irecv(receive_buffer.data() + p * n,
+                  n * sizeof(double),
+                  MPI_BYTE,
+                  pattern.neighbors[p],
+                  0,
+                  MPI_COMM_WORLD,
+                  &requests[p]);
+
+      for (unsigned int p = 0; p < n_neighbors; ++p)
+        for (unsigned int k = 0; k < n; ++k)
+          send_buffer[p * n + k] = payload(rank, round, k);
+
+      for (unsigned int p = 0; p < n_neighbors; ++p)
+        MPI_Isend(send_buffer.data() + p * n,
+                  n * sizeof(double),
+                  MPI_BYTE,
+                  pattern.neighbors[p],
+                  0,
+                  MPI_COMM_WORLD,
+                  &requests[n_neighbors + p]);
+
+      MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    }
+
+    const double elapsed = MPI_Wtime() - start;
+    ok &= check(pattern, receive_buffer, n_rounds - 1);
+    return elapsed;
+  }
+
+
+  /* Variant 2: persistent requests started with MPI_Startall() */
+  double exchange_persistent(const Pattern &pattern,
+                             const unsigned int n_rounds,
+                             bool &ok)
+  {
+    const auto rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    const unsigned int n = pattern.n_doubles;
+    const auto n_neighbors = pattern.neighbors.size();
+
+    std::vector<double> receive_buffer(n_neighbors * n);
+
+    ryujin::PersistentRequests<double> requests;
+    auto &set = requests.create(
+        {{receive_buffer.data()}, 0, ryujin::PayloadPrecision::full});
+    set.n_receives = n_neighbors;
+    set.requests.resize(2 * n_neighbors);
+    set.send_buffer.resize(n_neighbors * n);
+
+    for (unsigned int p = 0; p < n_neighbors; ++p) {
+      MPI_Recv_init(receive_buffer.data() + p * n,
+                    n * sizeof(double),
+                    MPI_BYTE,
+                    pattern.neighbors[p],
+                    0,
+                    MPI_COMM_WORLD,
+                    &set.requests[p]);
+      MPI_Send_init(set.send_buffer.data() + p * n,
+                    n * sizeof(double),
+                    MPI_BYTE,
+                    pattern.neighbors[p],
+                    0,
+                    MPI_COMM_WORLD,
+                    &set.requests[n_neighbors + p]);
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double start = MPI_Wtime();
+
+    for (unsigned int round = 0; round < n_rounds; ++round) {
+      ryujin::PersistentRequests<double>::start_receives(set);
+
+      for (unsigned int p = 0; p < n_neighbors; ++p)
+        for (unsigned int k = 0; k < n; ++k)
+          set.send_buffer[p * n + k] = payload(rank, round, k);
+
+      ryujin::PersistentRequests<double>::start_sends(set);
+      ryujin::PersistentRequests<double>::wait(set);
+    }
+
+    const double elapsed = MPI_Wtime() - start;
+    ok &= check(pattern, receive_buffer, n_rounds - 1);
+    return elapsed;
+  }
+} // namespace
+
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  const bool benchmark = argc > 1 && std::strcmp(argv[1], "--benchmark") == 0;
+
+  const int rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const int n_ranks = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  /* Neighbors must be symmetric and unique: */
+  std::set<int> neighbors;
+  for (int offset = 1; offset <= 3; ++offset) {
+    if ((rank + offset) % n_ranks != rank)
+      neighbors.insert((rank + offset) % n_ranks);
+    if ((rank + n_ranks - offset) % n_ranks != rank)
+      neighbors.insert((rank + n_ranks - offset) % n_ranks);
+  }
+
+  Pattern pattern;
+  pattern.neighbors.assign(neighbors.begin(), neighbors.end());
+
+  bool ok = true;
+
+  if (rank == 0 && benchmark)
+    std::cout << "  message size   immediate [us]  persistent [us]   speedup"
+              << std::endl;
+
+  for (unsigned int n_doubles = 1; n_doubles <= 65536; n_doubles *= 4) {
+    pattern.n_doubles = n_doubles;
+    const unsigned int n_rounds = benchmark ? 20000 / (1 + n_doubles / 64) : 3;
+
+    /* Warm up both variants once: */
+    exchange_immediate(pattern, n_rounds, ok);
+    exchange_persistent(pattern, n_rounds, ok);
+
+    const double immediate = dealii::Utilities::MPI::max(
+        exchange_immediate(pattern, n_rounds, ok), MPI_COMM_WORLD);
+    const double persistent = dealii::Utilities::MPI::max(
+        exchange_persistent(pattern, n_rounds, ok), MPI_COMM_WORLD);
+
+    if (rank == 0 && benchmark)
+      std::cout << std::setw(12) << n_doubles * sizeof(double) << " B"
+                << std::setw(17) << std::fixed << std::setprecision(3)
+                << 1.e6 * immediate / n_rounds << std::setw(17)
+                << 1.e6 * persistent / n_rounds << std::setw(10)
+                << immediate / persistent << std::endl;
+  }
+
+  for (int p = 0; p < n_ranks; ++p) {
+    if (p == rank)
+      std::cout << "Rank " << p << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    MPI_Barrier(MPI_COMM_WORLD);
+  }
+}
@@ -0,0 +1,142 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+#include <cmath>
+
+/*
+ * Same as sparse_matrix_simd.cc, but with matrix entries stored in single
+ * precision (as selected by the MIXED_PRECISION_OFFLINE_MATRICES option)
+ * and accessed in double precision. The integer entries of the first part
+ * are exactly representable, so the output agrees with
+ * sparse_matrix_simd.output. The second part checks that entries that are
+ * not representable are rounded to nearest (i.e., carry a relative error
+ * of at most 2^-24), and that the vectorized load, gather and store paths
+ * agree with the scalar conversion.
+ */
+
+int main()
+{
+  using VA = dealii::VectorizedArray<double>;
+  constexpr auto simd_width = VA::size();
+
+  dealii::DynamicSparsityPattern spars(14, 14);
+  spars.add(0, 0);
+  spars.add(0, 1);
+  spars.add(0, 13);
+  for (unsigned int i = 1; i < 12; ++i) {
+    spars.add(i, i - 1);
+    spars.add(i, i);
+    spars.add(i, i + 1);
+  }
+  spars.add(12, 12);
+  spars.add(12, 11);
+  spars.add(13, 13);
+  spars.add(13, 0);
+  spars.compress();
+
+  dealii::IndexSet locally_owned(14);
+  locally_owned.add_range(0, 14);
+  dealii::IndexSet locally_relevant(14);
+  auto partitioner = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+      locally_owned, locally_relevant, MPI_COMM_SELF);
+
+  ryujin::SparsityPatternSIMD<simd_width> my_sparsity(
+      (12 / simd_width) * simd_width, spars, partitioner);
+  ryujin::SparseMatrixSIMD<double, 1, simd_width, float> my_sparse(
+      my_sparsity);
+  for (unsigned i = 0; i < 12; ++i)
+    for (unsigned j = 0; j < 3; ++j)
+      my_sparse.write_entry(double(i * 3 + j), i, j);
+  my_sparse.write_entry(36., 12, 0);
+  my_sparse.write_entry(37., 12, 1);
+  my_sparse.write_entry(38., 13, 0);
+  my_sparse.write_entry(39., 13, 1);
+  std::cout << "Matrix entries row by row" << std::endl;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i) {
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const auto a = my_sparse.get_entry(i, j);
+      std::cout << a << " ";
+    }
+    std::cout << std::endl;
+  }
+  std::cout << "Matrix entries by SIMD rows" << std::endl;
+  unsigned int i = 0;
+  for (; i < (12 / simd_width) * simd_width; i += simd_width) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto a = my_sparse.template get_entry<VA>(i, j);
+      std::cout << a << "   ";
+    }
+    std::cout << std::endl;
+  }
+  for (; i < 14; i++)
+    std::cout << my_sparse.get_entry(i, 0) << " " << my_sparse.get_entry(i, 1)
+              << " ";
+  std::cout << std::endl;
+
+  std::cout << "Matrix entries transposed row by row" << std::endl;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i) {
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const auto a = my_sparse.get_transposed_entry(i, j);
+      std::cout << a << " ";
+    }
+    std::cout << std::endl;
+  }
+
+  std::cout << "Matrix entries transposed by SIMD row" << std::endl;
+  i = 0;
+  for (; i < (12 / simd_width) * simd_width; i += simd_width) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto a = my_sparse.template get_transposed_entry<VA>(i, j);
+      std::cout << a << "   ";
+    }
+    std::cout << std::endl;
+  }
+  for (; i < 14; i++)
+    std::cout << my_sparse.get_transposed_entry(i, 0) << " "
+              << my_sparse.get_transposed_entry(i, 1) << " ";
+  std::cout << std::endl;
+
+  const auto value = [](unsigned int i, unsigned int j) {
+    return 1. / double(3 * i + j + 3);
+  };
+
+  /* Vectorized stores for the SIMD rows, scalar stores otherwise: */
+  i = 0;
+  for (; i < (12 / simd_width) * simd_width; i += simd_width)
+    for (unsigned int j = 0; j < 3; ++j) {
+      VA entry;
+      for (unsigned int k = 0; k < simd_width; ++k)
+        entry[k] = value(i + k, j);
+      my_sparse.write_entry(entry, i, j);
+    }
+  for (; i < 14; i++)
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j)
+      my_sparse.write_entry(value(i, j), i, j);
+
+  bool rounding_ok = true;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i)
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const double a = my_sparse.get_entry(i, j);
+      rounding_ok &= (a == double(float(value(i, j))));
+      rounding_ok &=
+          std::abs(a - value(i, j)) <= std::ldexp(1., -24) * value(i, j);
+    }
+  std::cout << "Rounding to single precision: "
+            << (rounding_ok ? "OK" : "FAILED") << std::endl;
+
+  bool load_ok = true;
+  bool gather_ok = true;
+  for (i = 0; i < (12 / simd_width) * simd_width; i += simd_width)
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto a = my_sparse.template get_entry<VA>(i, j);
+      const auto b = my_sparse.template get_transposed_entry<VA>(i, j);
+      for (unsigned int k = 0; k < simd_width; ++k) {
+        load_ok &= (a[k] == my_sparse.get_entry(i + k, j));
+        gather_ok &= (b[k] == my_sparse.get_transposed_entry(i + k, j));
+      }
+    }
+  std::cout << "Vectorized load: " << (load_ok ? "OK" : "FAILED")
+            << std::endl;
+  std::cout << "Vectorized gather: " << (gather_ok ? "OK" : "FAILED")
+            << std::endl;
+}
@@ -0,0 +1,239 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+/*
+ * Exhaustively compare a SparsityPatternSIMD using compressed 16-bit
+ * column indices against the uncompressed variant.
+ *
+ * We use a periodic 5-point stencil on a 400 x 400 grid split over two
+ * MPI ranks. The first and last grid lines couple to ghost indices on the
+ * other rank whose local indices are further away than 2^16, which forces
+ * the fallback to uncompressed storage for these row chunks. In addition,
+ * the last 64 locally owned rows of each rank (which lie outside of the
+ * vectorized index range) couple to the corresponding rows of the other
+ * rank.
+ */
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  const auto mpi_rank =
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  const auto n_mpi_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  AssertThrow(n_mpi_processes == 2, dealii::ExcMessage("set up for 2 ranks"));
+
+  using VA = dealii::VectorizedArray<double>;
+  constexpr auto simd_width = VA::size();
+
+  constexpr unsigned int n_x = 400;
+  constexpr unsigned int n_global = n_x * n_x;
+  constexpr unsigned int n_owned = n_global / 2;
+  constexpr unsigned int n_tail = 64;
+
+  const auto couplings = [&](const unsigned int g) {
+    const unsigned int x = g % n_x;
+    const unsigned int y = g / n_x;
+    std::vector<unsigned int> result{
+        g,
+        (x + 1) % n_x + y * n_x,
+        (x + n_x - 1) % n_x + y * n_x,
+        x + ((y + 1) % n_x) * n_x,
+        x + ((y + n_x - 1) % n_x) * n_x,
+    };
+    if (g % n_owned >= n_owned - n_tail)
+      result.push_back((g + n_owned) % n_global);
+    return result;
+  };
+
+  /* Set up locally owned and relevant index sets. */
+
+  const unsigned int first = mpi_rank * n_owned;
+
+  dealii::IndexSet locally_owned(n_global);
+  locally_owned.add_range(first, first + n_owned);
+
+  dealii::IndexSet locally_relevant(n_global);
+  locally_relevant.add_range(first, first + n_owned);
+  for (unsigned int g = first; g < first + n_owned; ++g)
+    for (const auto j : couplings(g))
+      locally_relevant.add_index(j);
+
+  const auto partitioner =
+      std::make_shared<dealii::Utilities::MPI::Partitioner>(
+          locally_owned, locally_relevant, MPI_COMM_WORLD);
+
+  /* Set up sparsity pattern: */
+
+  dealii::DynamicSparsityPattern dsp(n_global, n_global, locally_relevant);
+  for (unsigned int g = first; g < first + n_owned; ++g)
+    for (const auto j : couplings(g))
+      dsp.add(g, j);
+  dsp.compress();
+
+  const unsigned int n_internal =
+      (n_owned - n_tail) / simd_width * simd_width;
+
+  const ryujin::SparsityPatternSIMD<simd_width> plain(
+      n_internal, dsp, partitioner);
+  const ryujin::SparsityPatternSIMD<simd_width> compressed(
+      n_internal, dsp, partitioner, /*compress_indices*/ true);
+
+  unsigned int n_errors = 0;
+  const auto check = [&](const bool condition) {
+    if (!condition)
+      ++n_errors;
+  };
+
+  check(compressed.compressed_indices());
+  check(!plain.compressed_indices());
+  check(plain.n_rows() == compressed.n_rows());
+  check(plain.n_nonzero_elements() == compressed.n_nonzero_elements());
+
+  /* Compare column indices row by row: */
+
+  dealii::AlignedVector<unsigned int> buffer;
+  dealii::AlignedVector<unsigned int> buffer_previous;
+
+  for (unsigned int i = 0; i < plain.n_rows(); ++i) {
+    const unsigned int row_length = plain.row_length(i);
+    const unsigned int stride = plain.stride_of_row(i);
+    check(row_length == compressed.row_length(i));
+    check(stride == compressed.stride_of_row(i));
+
+    const unsigned int *js_compressed = compressed.columns(i, buffer);
+    const unsigned int *js_plain = plain.columns(i);
+    check(js_plain == plain.columns(i, buffer));
+    for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx)
+      check(js_plain[col_idx * stride] == js_compressed[col_idx * stride]);
+  }
+
+  /*
+   * Compare column indices of full SIMD row chunks. Keep the previous
+   * row chunk decoded in a second buffer to check that it stays valid:
+   */
+
+  for (unsigned int i = simd_width; i < n_internal; i += simd_width) {
+    const unsigned int row_length = plain.row_length(i);
+    const unsigned int row_length_previous = plain.row_length(i - simd_width);
+
+    const unsigned int *js_previous =
+        compressed.columns(i - simd_width, buffer_previous);
+    const unsigned int *js_compressed = compressed.columns(i, buffer);
+
+    const unsigned int *js_plain = plain.columns(i);
+    for (unsigned int e = 0; e < row_length * simd_width; ++e)
+      check(js_plain[e] == js_compressed[e]);
+
+    js_plain = plain.columns(i - simd_width);
+    for (unsigned int e = 0; e < row_length_previous * simd_width; ++e)
+      check(js_plain[e] == js_previous[e]);
+  }
+
+  /* Compare transposed entries: */
+
+  const auto value = [&](const unsigned int i, const unsigned int j) {
+    return 1000. * partitioner->local_to_global(i) +
+           partitioner->local_to_global(j);
+  };
+
+  ryujin::SparseMatrixSIMD<double> scalar_plain(plain);
+  ryujin::SparseMatrixSIMD<double> scalar_compressed(compressed);
+  ryujin::SparseMatrixSIMD<double, 2> tensor_plain(plain);
+  ryujin::SparseMatrixSIMD<double, 2> tensor_compressed(compressed);
+
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    const unsigned int row_length = plain.row_length(i);
+    const unsigned int stride = plain.stride_of_row(i);
+    const unsigned int *js = plain.columns(i);
+    for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+      const double entry = value(i, js[col_idx * stride]);
+      const dealii::Tensor<1, 2, double> tensor{{entry, -entry}};
+      scalar_plain.write_entry(entry, i, col_idx);
+      scalar_compressed.write_entry(entry, i, col_idx);
+      tensor_plain.write_entry(tensor, i, col_idx);
+      tensor_compressed.write_entry(tensor, i, col_idx);
+    }
+  }
+
+  scalar_plain.update_ghost_rows();
+  scalar_compressed.update_ghost_rows();
+  tensor_plain.update_ghost_rows();
+  tensor_compressed.update_ghost_rows();
+
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    const unsigned int row_length = plain.row_length(i);
+    const unsigned int stride = plain.stride_of_row(i);
+    const unsigned int *js = plain.columns(i);
+    for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+      const double expected = value(js[col_idx * stride], i);
+
+      const auto a = scalar_plain.get_transposed_entry(i, col_idx);
+      const auto b = scalar_compressed.get_transposed_entry(i, col_idx);
+      check(a == expected && b == expected);
+
+      const auto c = tensor_plain.get_transposed_tensor(i, col_idx);
+      const auto d = tensor_compressed.get_transposed_tensor(i, col_idx);
+      check(c[0] == expected && c[1] == -expected);
+      check(d[0] == expected && d[1] == -expected);
+    }
+  }
+
+  for (unsigned int i = 0; i < n_internal; i += simd_width) {
+    const unsigned int row_length = plain.row_length(i);
+    for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+      const auto a = scalar_plain.get_transposed_entry<VA>(i, col_idx);
+      const auto b = scalar_compressed.get_transposed_entry<VA>(i, col_idx);
+      for (unsigned int k = 0; k < simd_width; ++k)
+        check(a[k] == b[k]);
+    }
+  }
+
+  /*
+   * Repeat the exchange a couple of times with new values (reusing the
+   * persistent MPI requests), alternating communication channels and
+   * swapping the two scalar matrices in between:
+   */
+
+  for (unsigned int round = 1; round <= 4; ++round) {
+    std::swap(scalar_plain, scalar_compressed);
+
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      const unsigned int row_length = plain.row_length(i);
+      const unsigned int stride = plain.stride_of_row(i);
+      const unsigned int *js = plain.columns(i);
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        const double entry = value(i, js[col_idx * stride]) + round;
+        scalar_plain.write_entry(entry, i, col_idx);
+        scalar_compressed.write_entry(entry, i, col_idx);
+      }
+    }
+
+    scalar_plain.update_ghost_rows_start(round % 2);
+    scalar_plain.update_ghost_rows_finish();
+    scalar_compressed.update_ghost_rows_start(round % 2);
+    scalar_compressed.update_ghost_rows_finish();
+
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      const unsigned int row_length = plain.row_length(i);
+      const unsigned int stride = plain.stride_of_row(i);
+      const unsigned int *js = plain.columns(i);
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        const double expected = value(js[col_idx * stride], i) + round;
+        const auto a = scalar_plain.get_transposed_entry(i, col_idx);
+        const auto b = scalar_compressed.get_transposed_entry(i, col_idx);
+        check(a == expected && b == expected);
+      }
+    }
+  }
+
+  for (unsigned int p = 0; p < n_mpi_processes; ++p) {
+    if (p == mpi_rank)
+      std::cout << "Rank " << p << ": " << (n_errors == 0 ? "OK" : "FAILED")
+                << std::endl;
+    MPI_Barrier(MPI_COMM_WORLD);
+  }
+}
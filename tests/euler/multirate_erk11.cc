@@ -0,0 +1,197 @@
+#include "description.h"
+
+#include <compile_time_options.h>
+#include <discretization.h>
+#include <hyperbolic_module.h>
+#include <initial_values.h>
+#include <offline_data.h>
+#include <parabolic_module.h>
+#include <state_vector.h>
+#include <time_integrator.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_acceptor.h>
+#include <deal.II/base/timer.h>
+
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <sstream>
+
+/*
+ * Multirate erk 11 time stepping on a graded mesh: The isentropic vortex
+ * of euler-isentropic_vortex-multirate-erk11.prm is computed with slip
+ * boundary conditions on all sides, so that the total mass has to be
+ * conserved to round-off. With multirate levels L = 1 and L = 2 the total
+ * mass is checked after every cycle of 2^L substeps. Furthermore, the
+ * density at the final time has to agree with the one computed with the
+ * plain erk 11 scheme (L = 0) in the relative (lumped mass) L1 norm.
+ */
+
+using namespace ryujin;
+
+using Description = Euler::Description;
+constexpr int dim = 2;
+using Number = NUMBER;
+
+using View = Description::HyperbolicSystemView<dim, Number>;
+using StateVector = View::StateVector;
+
+const std::string parameters = R"(
+subsection B - Equation
+  set gamma = 1.4
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 4
+  set mesh writeout   = false
+  subsection rectangular domain
+    set boundary condition bottom = slip
+    set boundary condition left   = slip
+    set boundary condition right  = slip
+    set boundary condition top    = slip
+    set position bottom left      = -5, -5
+    set position top right        =  5,  5
+    set grading pull back         = 5/3*asinh(x*sinh(3)/5);5/3*asinh(y*sinh(3)/5)
+    set grading push forward      = 5*sinh(3*x/5)/sinh(3);5*sinh(3*y/5)/sinh(3)
+    set subdivisions x            = 2
+    set subdivisions y            = 2
+  end
+end
+subsection E - InitialValues
+  set configuration = isentropic vortex
+  set direction     =  1,  1
+  set position      = -1, -1
+  subsection isentropic vortex
+    set mach number = 1
+    set beta        = 5
+  end
+end
+subsection H - TimeIntegrator
+  set cfl min               = 0.2
+  set cfl max               = 0.2
+  set cfl recovery strategy = none
+  set time stepping scheme  = erk 11
+end
+)";
+
+constexpr Number t_final = 0.5;
+
+
+/*
+ * Run up to t_final with L multirate levels and return the lumped mass
+ * weighted density of all locally owned degrees of freedom. The number
+ * of steps that violate mass conservation is added to @p n_errors.
+ */
+std::vector<double> run(const unsigned int n_levels, unsigned int &n_errors)
+{
+  std::map<std::string, dealii::Timer> computing_timer;
+  std::vector<double> density;
+
+  {
+    const auto &mpi_comm = MPI_COMM_WORLD;
+
+    Description::HyperbolicSystem hyperbolic_system("/B - Equation");
+    Description::ParabolicSystem parabolic_system("/B - Equation");
+    Discretization<dim> discretization(mpi_comm, "/C - Discretization");
+    OfflineData<dim, Number> offline_data(
+        mpi_comm, discretization, "/D - OfflineData");
+    InitialValues<Description, dim, Number> initial_values(
+        hyperbolic_system, offline_data, "/E - InitialValues");
+    HyperbolicModule<Description, dim, Number> hyperbolic_module(
+        mpi_comm,
+        computing_timer,
+        offline_data,
+        hyperbolic_system,
+        initial_values,
+        "/F - HyperbolicModule");
+    ParabolicModule<Description, dim, Number> parabolic_module(
+        mpi_comm,
+        computing_timer,
+        offline_data,
+        hyperbolic_system,
+        parabolic_system,
+        initial_values,
+        "/G - ParabolicModule");
+    TimeIntegrator<Description, dim, Number> time_integrator(
+        mpi_comm,
+        offline_data,
+        hyperbolic_module,
+        parabolic_module,
+        "/H - TimeIntegrator");
+
+    std::istringstream input(parameters +
+                             "subsection F - HyperbolicModule\n"
+                             "  set multirate levels = " +
+                             std::to_string(n_levels) + "\nend\n");
+    dealii::ParameterAcceptor::initialize(input);
+
+    discretization.prepare("multirate_erk11");
+    offline_data.prepare(View::problem_dimension, View::n_precomputed_values);
+    hyperbolic_module.prepare();
+    parabolic_module.prepare();
+    time_integrator.prepare();
+
+    StateVector state_vector;
+    Vectors::reinit_state_vector<Description>(state_vector, offline_data);
+    std::get<0>(state_vector) = initial_values.interpolate_hyperbolic_vector();
+
+    const unsigned int n_owned = offline_data.n_locally_owned();
+    const auto &lumped_mass_matrix = offline_data.lumped_mass_matrix();
+
+    const auto compute_density = [&]() {
+      const auto &U = std::get<0>(state_vector);
+      density.resize(n_owned);
+      for (unsigned int i = 0; i < n_owned; ++i)
+        density[i] = lumped_mass_matrix.local_element(i) *
+                     U.local_element(i * View::problem_dimension);
+      return dealii::Utilities::MPI::sum(
+          std::accumulate(density.begin(), density.end(), 0.), mpi_comm);
+    };
+
+    const double initial_mass = compute_density();
+
+    Number t = 0.;
+    while (t < t_final) {
+      t += time_integrator.step(state_vector, t, t_final);
+
+      const double mass = compute_density();
+      if (std::abs(mass - initial_mass) > 1.e-12 * initial_mass)
+        ++n_errors;
+    }
+  }
+
+  /* All ParameterAcceptor objects have gone out of scope: */
+  dealii::ParameterAcceptor::clear();
+
+  return density;
+}
+
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  unsigned int n_errors = 0;
+  const auto reference = run(0, n_errors);
+
+  for (const unsigned int n_levels : {1u, 2u}) {
+    const auto density = run(n_levels, n_errors);
+
+    double difference = 0.;
+    double norm = 0.;
+    for (unsigned int i = 0; i < density.size(); ++i) {
+      difference += std::abs(density[i] - reference[i]);
+      norm += std::abs(reference[i]);
+    }
+    difference = dealii::Utilities::MPI::sum(difference, MPI_COMM_WORLD);
+    norm = dealii::Utilities::MPI::sum(norm, MPI_COMM_WORLD);
+
+    if (difference > 1.e-2 * norm)
+      ++n_errors;
+
+    if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+      std::cout << "L = " << n_levels << ": "
+                << (n_errors == 0 ? "OK" : "FAILED") << std::endl;
+  }
+}
@@ -0,0 +1,197 @@
+#include "description.h"
+
+#include <compile_time_options.h>
+#include <discretization.h>
+#include <hyperbolic_module.h>
+#include <initial_values.h>
+#include <offline_data.h>
+#include <parabolic_module.h>
+#include <state_vector.h>
+#include <time_integrator.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_acceptor.h>
+#include <deal.II/base/timer.h>
+
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <vector>
+
+/*
+ * Embedded error control: The isentropic vortex of
+ * euler-isentropic_vortex-erk54-embedded.prm is computed on refinement
+ * level 5 with fixed-step "erk 54" (cfl 0.2) and with embedded error
+ * control. The controller has to start with "cfl max", has to stay
+ * within [cfl min, embedded cfl max], may change the CFL number by at
+ * most the factors 0.5 and 1.2 per step, and has to take fewer steps than
+ * the fixed-step scheme. Furthermore, the error against the analytic
+ * solution (dominated by the spatial discretization) has to agree with
+ * the fixed-step error up to a factor of 1.5.
+ */
+
+using namespace ryujin;
+
+using Description = Euler::Description;
+constexpr int dim = 2;
+using Number = NUMBER;
+
+using View = Description::HyperbolicSystemView<dim, Number>;
+using StateVector = View::StateVector;
+
+const std::string parameters = R"(
+subsection B - Equation
+  set gamma = 1.4
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 5
+  set mesh writeout   = false
+  subsection rectangular domain
+    set boundary condition bottom = dirichlet
+    set boundary condition left   = dirichlet
+    set boundary condition right  = dirichlet
+    set boundary condition top    = dirichlet
+    set position bottom left      = -5, -5
+    set position top right        =  5,  5
+  end
+end
+subsection E - InitialValues
+  set configuration = isentropic vortex
+  set direction     =  1,  1
+  set position      = -1, -1
+  subsection isentropic vortex
+    set mach number = 1
+    set beta        = 5
+  end
+end
+subsection H - TimeIntegrator
+  set cfl min               = 0.2
+  set cfl max               = 0.2
+  set cfl recovery strategy = none
+  set time stepping scheme  = erk 54
+  set embedded cfl max      = 0.9
+)";
+
+constexpr Number t_final = 2.0;
+
+
+/*
+ * Run up to t_final with the given embedded error tolerance and return
+ * the relative (lumped mass) L1 error of the density. The CFL number of
+ * every time step is stored in @p cfl_numbers.
+ */
+double run(const std::string &tolerance, std::vector<double> &cfl_numbers)
+{
+  std::map<std::string, dealii::Timer> computing_timer;
+  double error = 0.;
+
+  {
+    const auto &mpi_comm = MPI_COMM_WORLD;
+
+    Description::HyperbolicSystem hyperbolic_system("/B - Equation");
+    Description::ParabolicSystem parabolic_system("/B - Equation");
+    Discretization<dim> discretization(mpi_comm, "/C - Discretization");
+    OfflineData<dim, Number> offline_data(
+        mpi_comm, discretization, "/D - OfflineData");
+    InitialValues<Description, dim, Number> initial_values(
+        hyperbolic_system, offline_data, "/E - InitialValues");
+    HyperbolicModule<Description, dim, Number> hyperbolic_module(
+        mpi_comm,
+        computing_timer,
+        offline_data,
+        hyperbolic_system,
+        initial_values,
+        "/F - HyperbolicModule");
+    ParabolicModule<Description, dim, Number> parabolic_module(
+        mpi_comm,
+        computing_timer,
+        offline_data,
+        hyperbolic_system,
+        parabolic_system,
+        initial_values,
+        "/G - ParabolicModule");
+    TimeIntegrator<Description, dim, Number> time_integrator(
+        mpi_comm,
+        offline_data,
+        hyperbolic_module,
+        parabolic_module,
+        "/H - TimeIntegrator");
+
+    std::istringstream input(parameters + "  set embedded error tolerance = " +
+                             tolerance + "\nend\n");
+    dealii::ParameterAcceptor::initialize(input);
+
+    discretization.prepare("time_integrator-embedded");
+    offline_data.prepare(View::problem_dimension, View::n_precomputed_values);
+    hyperbolic_module.prepare();
+    parabolic_module.prepare();
+    time_integrator.prepare();
+
+    StateVector state_vector;
+    Vectors::reinit_state_vector<Description>(state_vector, offline_data);
+    std::get<0>(state_vector) = initial_values.interpolate_hyperbolic_vector();
+
+    cfl_numbers.clear();
+    Number t = 0.;
+    while (t < t_final) {
+      t += time_integrator.step(state_vector, t, t_final);
+      cfl_numbers.push_back(hyperbolic_module.cfl());
+    }
+
+    const auto &U = std::get<0>(state_vector);
+    const auto reference = initial_values.interpolate_hyperbolic_vector(t);
+    const auto &lumped_mass_matrix = offline_data.lumped_mass_matrix();
+
+    double difference = 0.;
+    double norm = 0.;
+    for (unsigned int i = 0; i < offline_data.n_locally_owned(); ++i) {
+      const auto k = i * View::problem_dimension;
+      const double m_i = lumped_mass_matrix.local_element(i);
+      difference += m_i * std::abs(U.local_element(k) -
+                                   reference.local_element(k));
+      norm += m_i * std::abs(reference.local_element(k));
+    }
+    difference = dealii::Utilities::MPI::sum(difference, mpi_comm);
+    norm = dealii::Utilities::MPI::sum(norm, mpi_comm);
+    error = difference / norm;
+  }
+
+  /* All ParameterAcceptor objects have gone out of scope: */
+  dealii::ParameterAcceptor::clear();
+
+  return error;
+}
+
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  std::vector<double> cfl_fixed;
+  std::vector<double> cfl_embedded;
+  const auto error_fixed = run("0", cfl_fixed);
+  const auto error_embedded = run("1.e-6", cfl_embedded);
+
+  /* Allow for round-off in the comparisons: */
+  constexpr double eps = 1.e-6;
+
+  bool sequence_ok = !cfl_embedded.empty() &&
+                     std::abs(cfl_embedded.front() - 0.2) < eps;
+  for (unsigned int n = 0; n < cfl_embedded.size(); ++n) {
+    sequence_ok &= cfl_embedded[n] > 0.2 - eps && cfl_embedded[n] < 0.9 + eps;
+    if (n > 0)
+      sequence_ok &= cfl_embedded[n] > (0.5 - eps) * cfl_embedded[n - 1] &&
+                     cfl_embedded[n] < (1.2 + eps) * cfl_embedded[n - 1];
+  }
+
+  const bool steps_ok = cfl_embedded.size() < cfl_fixed.size();
+  const bool error_ok = error_embedded < 1.5 * error_fixed;
+
+  if (dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0) {
+    std::cout << "cfl sequence: " << (sequence_ok ? "OK" : "FAILED")
+              << std::endl;
+    std::cout << "step count:   " << (steps_ok ? "OK" : "FAILED") << std::endl;
+    std::cout << "error:        " << (error_ok ? "OK" : "FAILED") << std::endl;
+  }
+}